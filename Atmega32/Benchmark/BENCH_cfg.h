@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:42:10                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:35:00                              *
+ * @FilePath              : BENCH_cfg.h                                      *
+ ****************************************************************************/
+
+#ifndef BENCHMARK_BENCH_CFG_H_
+#define BENCHMARK_BENCH_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Number of measured calls per API
+ * @note Minimum value is 1 and Maximum value is 255.
+ */
+
+#define BENCH_ITERATIONS                    32U
+
+/**
+ * @brief GPIO Pin used by GPIO APIs benchmark
+ * @note The pin is set as output during the benchmark.
+ */
+
+#define BENCH_GPIO_PORT                     PORT_B
+#define BENCH_GPIO_PIN                      PIN_3
+
+/**
+ * @brief EEPROM Address read by EEPROM_read_data benchmark (one byte per call)
+ */
+
+#define BENCH_EEPROM_ADDRESS                0U
+
+/**
+ * @brief Cycles Budgets per call
+ * @note The benchmark fails with BENCH_BUDGET_EXCEEDED if the worst case of an API exceeds its budget.
+ * @note MM_set_mode is measured with NORMAL_MODE as the sleep modes need a wake-up source.
+ * @note The inline GPIO APIs (GPIO_fast.h) are measured with constant arguments, so they are compiled to one or a few
+ * instructions without a call.
+ */
+
+#define BENCH_GPIO_SET_PIN_LEVEL_BUDGET          60U
+#define BENCH_GPIO_GET_PIN_LEVEL_BUDGET          80U
+#define BENCH_GPIO_TOG_PIN_LEVEL_BUDGET          60U
+#define BENCH_GPIO_SET_PIN_LEVEL_FAST_BUDGET     10U
+#define BENCH_GPIO_GET_PIN_LEVEL_FAST_BUDGET     10U
+#define BENCH_GPIO_TOG_PIN_LEVEL_FAST_BUDGET     10U
+#define BENCH_EEPROM_READ_DATA_BUDGET            150U
+#define BENCH_MM_SET_MODE_BUDGET                 40U
+
+#endif
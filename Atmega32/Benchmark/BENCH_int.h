@@ -0,0 +1,70 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:41:36                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:35:00                              *
+ * @FilePath              : BENCH_int.h                                      *
+ ****************************************************************************/
+
+#ifndef BENCHMARK_BENCH_INT_H_
+#define BENCHMARK_BENCH_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Benchmarked APIs
+ */
+typedef enum
+{
+    BENCH_GPIO_SET_PIN_LEVEL = (uint8_t)0,
+    BENCH_GPIO_GET_PIN_LEVEL            ,
+    BENCH_GPIO_TOG_PIN_LEVEL            ,
+    BENCH_GPIO_SET_PIN_LEVEL_FAST       ,
+    BENCH_GPIO_GET_PIN_LEVEL_FAST       ,
+    BENCH_GPIO_TOG_PIN_LEVEL_FAST       ,
+    BENCH_EEPROM_READ_DATA              ,
+    BENCH_MM_SET_MODE                   ,
+    BENCH_MAX_API
+}bench_api_t;
+
+/**
+ * @brief Benchmark Result of one API
+ * @note Cycles are CPU cycles per call after removing the measurement overhead (simulated register accesses in HOST_SIM).
+ */
+typedef struct
+{
+    uint16_t min_cycles;          /* Best case cycles per call                          */
+    uint16_t max_cycles;          /* Worst case cycles per call (compared to the budget) */
+    uint16_t average_cycles;      /* Average cycles per call                            */
+    uint16_t budget_cycles;       /* Configured budget                                  */
+    driver_status_t status;       /* DRIVER_IS_OK or BENCH_BUDGET_EXCEEDED              */
+}bench_result_t;
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Benchmark Results Table (readable by symbol from the simulator or the debugger).
+ */
+extern bench_result_t BENCH_results[BENCH_MAX_API];
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t BENCH_run        (void);
+driver_status_t BENCH_get_result (bench_api_t api, bench_result_t * result);
+
+#endif
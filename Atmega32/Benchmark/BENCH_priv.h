@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:42:44                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 11:42:44                              *
+ * @FilePath              : BENCH_priv.h                                     *
+ ****************************************************************************/
+
+#ifndef BENCHMARK_BENCH_PRIV_H_
+#define BENCHMARK_BENCH_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Measurement
+ */
+
+#define BENCH_NO_API                    BENCH_MAX_API
+#define BENCH_MAX_CYCLES                0xFFFFU
+#define BENCH_NO_CYCLES                 0U
+
+/**
+ * @brief EEPROM read length per call
+ */
+
+#define BENCH_EEPROM_READ_LENGTH        1U
+#define BENCH_NO_DATA                   0U
+
+#endif
@@ -0,0 +1,259 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:43:20                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:35:00                              *
+ * @FilePath              : BENCH_prog.c                                     *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "../GPIO/GPIO_int.h"
+#include "../GPIO/GPIO_fast.h"
+#include "../EEPROM/EEPROM_int.h"
+#include "../ModeManager/MM_int.h"
+#include "../Timebase/TB_int.h"
+#include "../Timebase/TB_priv.h"
+#include "../Timebase/TB_cfg.h"
+#include "BENCH_int.h"
+#include "BENCH_priv.h"
+#include "BENCH_cfg.h"
+
+#if TB_PRESCALER != TB_PRESCALER_1
+#error "Benchmark needs TB_PRESCALER_1 so that each timebase tick is one CPU cycle"
+#endif
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Benchmark Results Table.
+ */
+bench_result_t BENCH_results[BENCH_MAX_API];
+
+/**
+ * @brief Cycles Budgets of the APIs (same order as bench_api_t).
+ */
+static const uint16_t BENCH_budgets[BENCH_MAX_API] FLASH_CONST =
+{
+    BENCH_GPIO_SET_PIN_LEVEL_BUDGET,
+    BENCH_GPIO_GET_PIN_LEVEL_BUDGET,
+    BENCH_GPIO_TOG_PIN_LEVEL_BUDGET,
+    BENCH_GPIO_SET_PIN_LEVEL_FAST_BUDGET,
+    BENCH_GPIO_GET_PIN_LEVEL_FAST_BUDGET,
+    BENCH_GPIO_TOG_PIN_LEVEL_FAST_BUDGET,
+    BENCH_EEPROM_READ_DATA_BUDGET,
+    BENCH_MM_SET_MODE_BUDGET
+};
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to call the benchmarked API once.
+ * @param api The benchmarked API (BENCH_NO_API calls nothing and is used to measure the overhead).
+ */
+static void BENCH_call(bench_api_t api)
+{
+    gpio_level_t level = PIN_LOW_LEVEL;
+    uint8_t data = CLEAR_VALUE;
+    uint16_t actual_length = BENCH_NO_DATA;
+
+    switch (api)
+    {
+    case BENCH_GPIO_SET_PIN_LEVEL:
+        (void)GPIO_set_pin_level(BENCH_GPIO_PORT, BENCH_GPIO_PIN, PIN_HIGH_LEVEL);
+        break;
+    case BENCH_GPIO_GET_PIN_LEVEL:
+        (void)GPIO_get_pin_level(BENCH_GPIO_PORT, BENCH_GPIO_PIN, &level);
+        break;
+    case BENCH_GPIO_TOG_PIN_LEVEL:
+        (void)GPIO_tog_pin_level(BENCH_GPIO_PORT, BENCH_GPIO_PIN);
+        break;
+    case BENCH_GPIO_SET_PIN_LEVEL_FAST:
+        (void)GPIO_set_pin_level_fast(BENCH_GPIO_PORT, BENCH_GPIO_PIN, PIN_HIGH_LEVEL);
+        break;
+    case BENCH_GPIO_GET_PIN_LEVEL_FAST:
+        (void)GPIO_get_pin_level_fast(BENCH_GPIO_PORT, BENCH_GPIO_PIN, &level);
+        break;
+    case BENCH_GPIO_TOG_PIN_LEVEL_FAST:
+        (void)GPIO_tog_pin_level_fast(BENCH_GPIO_PORT, BENCH_GPIO_PIN);
+        break;
+    case BENCH_EEPROM_READ_DATA:
+        (void)EEPROM_read_data(BENCH_EEPROM_ADDRESS, &data, BENCH_EEPROM_READ_LENGTH, &actual_length);
+        break;
+    case BENCH_MM_SET_MODE:
+        (void)MM_set_mode(NORMAL_MODE);
+        break;
+    default:
+        /* Overhead measurement */
+        break;
+    }
+}
+
+/**
+ * @brief This function is used to measure the cycles of one call.
+ * @param api The benchmarked API.
+ * @return The number of cycles including the measurement overhead.
+ */
+static uint16_t BENCH_measure(bench_api_t api)
+{
+    uint16_t start = 0U;
+    uint16_t end = 0U;
+
+    start = TB_get_ticks();
+    BENCH_call(api);
+    end = TB_get_ticks();
+
+    return (uint16_t)(end - start);
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to measure the cycles per call of each driver API and compare them to their budgets.
+ * @note Global Interrupt is disabled during the benchmark so interrupts are not counted.
+ * @note The results are stored in BENCH_results and can be read by BENCH_get_result.
+ * @note The Timebase is started if it is not started yet, a running Timebase is not reset.
+ * @note In HOST_SIM, the cycles are simulated register accesses (SIM_CYCLES_PER_ACCESS each), so they are only
+ * used to compare builds and the budgets are not checked (they are checked on the target or on simavr).
+ * @return The status of Benchmark (DRIVER_IS_OK, BENCH_BUDGET_EXCEEDED or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t BENCH_run(void)
+{
+    driver_status_t BENCH_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint8_t api = 0U;
+    uint8_t iteration = 0U;
+    uint16_t overhead = BENCH_MAX_CYCLES;
+    uint16_t cycles = BENCH_NO_CYCLES;
+    uint32_t total = 0U;
+
+    /* Start the timebase if it is not started yet */
+    BENCH_status = TB_init();
+
+    if (BENCH_status == DRIVER_IS_OK)
+    {
+        /* Save Interrupts state and disable them during the benchmark */
+        ATOMIC_ENTER(sreg_state, ILT_BENCH_RUN);
+
+        /* Prepare the drivers */
+        (void)GPIO_set_pin_mode(BENCH_GPIO_PORT, BENCH_GPIO_PIN, PIN_OUTPUT);
+
+        /* Measure the overhead (best case of the measurement without API) */
+        for (iteration = 0U; iteration < BENCH_ITERATIONS; iteration++)
+        {
+            cycles = BENCH_measure(BENCH_NO_API);
+            if (cycles < overhead)
+            {
+                overhead = cycles;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        /* Measure each API */
+        for (api = 0U; api < BENCH_MAX_API; api++)
+        {
+            BENCH_results[api].min_cycles = BENCH_MAX_CYCLES;
+            BENCH_results[api].max_cycles = BENCH_NO_CYCLES;
+            BENCH_results[api].budget_cycles = FLASH_READ_WORD(&BENCH_budgets[api]);
+            total = 0U;
+
+            for (iteration = 0U; iteration < BENCH_ITERATIONS; iteration++)
+            {
+                cycles = BENCH_measure((bench_api_t)api);
+
+                /* Remove the measurement overhead */
+                cycles = (cycles > overhead) ? (uint16_t)(cycles - overhead) : BENCH_NO_CYCLES;
+
+                /* Update the statistics */
+                if (cycles < BENCH_results[api].min_cycles)
+                {
+                    BENCH_results[api].min_cycles = cycles;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                if (cycles > BENCH_results[api].max_cycles)
+                {
+                    BENCH_results[api].max_cycles = cycles;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                total += cycles;
+            }
+            BENCH_results[api].average_cycles = (uint16_t)(total / BENCH_ITERATIONS);
+
+#if defined(HOST_SIM)
+            /* Simulated cycles are not CPU cycles, so the budget is not checked */
+            BENCH_results[api].status = DRIVER_IS_OK;
+#else
+            /* Check the budget of the API */
+            if (BENCH_results[api].max_cycles > BENCH_results[api].budget_cycles)
+            {
+                BENCH_results[api].status = BENCH_BUDGET_EXCEEDED;
+                BENCH_status = BENCH_BUDGET_EXCEEDED;
+            }
+            else
+            {
+                BENCH_results[api].status = DRIVER_IS_OK;
+            }
+#endif
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_BENCH_RUN);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Return Benchmark status */
+    return BENCH_status;
+}
+
+/**
+ * @brief This API is used to get the benchmark result of one API.
+ * @param api The benchmarked API (BENCH_GPIO_SET_PIN_LEVEL -> BENCH_MM_SET_MODE).
+ * @param result A pointer to the result of the API.
+ * @return The result and the status of Benchmark (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t BENCH_get_result(bench_api_t api, bench_result_t * result)
+{
+    driver_status_t BENCH_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (result == NULL_PTR)
+    {
+        BENCH_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the API is existed or not */
+    else if (api >= BENCH_MAX_API)
+    {
+        BENCH_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        *result = BENCH_results[api];
+    }
+
+    /* Return Benchmark status */
+    return BENCH_status;
+}
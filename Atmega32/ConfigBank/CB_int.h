@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:12:37                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 16:12:37                              *
+ * @FilePath              : CB_int.h                                         *
+ ****************************************************************************/
+
+#ifndef CONFIGBANK_CB_INT_H_
+#define CONFIGBANK_CB_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Configuration Bank Handle
+ * @note The region holds a commit byte followed by two banks (A and B) of block_size bytes, the commit byte selects
+ * the active bank.
+ * @note Members are managed by the Configuration Bank APIs and must not be changed by the caller.
+ */
+typedef struct
+{
+    uint16_t  base_address;         /* The start Address of the region in EEPROM                        */
+    uint16_t  block_size;           /* Size of the configuration block in bytes                         */
+    uint8_t   active_bank;          /* Bank which holds the committed configuration                     */
+    uint8_t   commit_phase;         /* Phase of the running commit (copy then flip)                     */
+    uint8_t * commit_data;          /* Configuration block of the running commit                        */
+    uint16_t  commit_length;        /* Bytes which have been stored in the running phase                */
+    uint32_t  programmed_bytes;     /* Number of programmed EEPROM bytes since initialization           */
+}cb_bank_t;
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t CB_init    (cb_bank_t * bank, uint16_t base_address, uint16_t block_size);
+driver_status_t CB_read    (cb_bank_t * bank, uint8_t * data);
+driver_status_t CB_commit  (cb_bank_t * bank, uint8_t * data);
+
+#endif
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:13:05                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 16:13:05                              *
+ * @FilePath              : CB_priv.h                                        *
+ ****************************************************************************/
+
+#ifndef CONFIGBANK_CB_PRIV_H_
+#define CONFIGBANK_CB_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Banks
+ */
+
+#define CB_BANK_A                       0U
+#define CB_BANK_B                       1U
+
+/**
+ * @brief Commit Byte Values
+ * @note Any value other than CB_COMMIT_BANK_B (erased or interrupted write) selects bank A.
+ */
+
+#define CB_COMMIT_SIZE                  1U
+#define CB_COMMIT_BANK_A                0x5AU
+#define CB_COMMIT_BANK_B                0xA5U
+
+/**
+ * @brief Commit Phases
+ */
+
+#define CB_COMMIT_IDLE                  0U
+#define CB_COMMIT_COPY                  1U
+#define CB_COMMIT_FLIP                  2U
+
+/**
+ * @brief Compare Results
+ */
+
+#define CB_IS_EQUAL                     0U
+#define CB_IS_DIFFERENT                 1U
+
+/**
+ * @brief Number of EEPROM bytes which are read at once during comparisons
+ */
+
+#define CB_COMPARE_CHUNK                8U
+
+/**
+ * @brief Bank Address in EEPROM
+ */
+
+#define CB_REGION_LENGTH(block_size)    ((uint16_t)(CB_COMMIT_SIZE + (2U * (block_size))))
+#define CB_BANK_ADDRESS(bank, index)    ((uint16_t)((bank)->base_address + CB_COMMIT_SIZE + ((index) * (bank)->block_size)))
+#define CB_OTHER_BANK(index)            ((uint8_t)((index) ^ CB_BANK_B))
+
+#endif
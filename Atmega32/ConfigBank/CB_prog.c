@@ -0,0 +1,252 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:14:21                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:18:00                              *
+ * @FilePath              : CB_prog.c                                        *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../EEPROM/EEPROM_int.h"
+#include "../EEPROM/EEPROM_priv.h"
+#include "CB_int.h"
+#include "CB_priv.h"
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to compare successive bytes of EEPROM with the given data.
+ * @param address The start Address in EEPROM.
+ * @param data A pointer to the data.
+ * @param length The number of bytes.
+ * @note EEPROM is read in chunks of CB_COMPARE_CHUNK bytes, and the comparison stops at the first different chunk.
+ * @return CB_IS_EQUAL if all bytes are equal, otherwise CB_IS_DIFFERENT.
+ */
+static uint8_t CB_compare(uint16_t address, uint8_t * data, uint16_t length)
+{
+    uint8_t chunk[CB_COMPARE_CHUNK];
+    uint8_t result = CB_IS_EQUAL;
+    uint16_t offset = 0U;
+    uint8_t chunk_length = 0U;
+    uint8_t index = 0U;
+
+    while ((offset < length) && (result == CB_IS_EQUAL))
+    {
+        /* Read the next chunk */
+        chunk_length = ((uint16_t)(length - offset) < CB_COMPARE_CHUNK) ? (uint8_t)(length - offset) : (uint8_t)CB_COMPARE_CHUNK;
+        if (EEPROM_read_bytes((uint16_t)(address + offset), chunk, chunk_length) != EEPROM_DATA_IS_READ)
+        {
+            result = CB_IS_DIFFERENT;
+        }
+        else
+        {
+            /* Compare the chunk */
+            for (index = 0U; index < chunk_length; index++)
+            {
+                if (chunk[index] != data[offset + index])
+                {
+                    result = CB_IS_DIFFERENT;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+        }
+        offset = (uint16_t)(offset + chunk_length);
+    }
+
+    return result;
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to open a configuration bank over an EEPROM region and select its active bank.
+ * @param bank A pointer to the bank handle which is owned by the caller.
+ * @param base_address The start Address of the region in EEPROM.
+ * @param block_size The size of the configuration block in bytes (the region holds 2 * block_size + 1 bytes).
+ * @note Only the commit byte is read, bank B is active if it holds CB_COMMIT_BANK_B otherwise bank A is active, so
+ * a commit byte whose write has been interrupted selects either the previous or the verified new configuration.
+ * @note An erased region reads as bank A full of 0xFF.
+ * @return The status of Configuration Bank (DRIVER_IS_OK, EEPROM_ADDRESS_NOT_AVAILABLE, VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER
+ * or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t CB_init(cb_bank_t * bank, uint16_t base_address, uint16_t block_size)
+{
+    driver_status_t CB_status = DRIVER_IS_OK;
+    uint8_t commit = CB_COMMIT_BANK_A;
+
+    /* Check if the pointer is null pointer */
+    if (bank == NULL_PTR)
+    {
+        CB_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the block size is accepted */
+    else if ((block_size == EEPROM_NO_DATA) || (block_size > (EEPROM_LAST_LOCATION / 2U)))
+    {
+        CB_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    /* Check if the region is in available EEPROM Space */
+    else if ((base_address > EEPROM_LAST_LOCATION) ||
+             ((CB_REGION_LENGTH(block_size) - 1U) > (EEPROM_LAST_LOCATION - base_address)))
+    {
+        CB_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+    else
+    {
+        /* Set the bank layout */
+        bank->base_address = base_address;
+        bank->block_size = block_size;
+        bank->commit_phase = CB_COMMIT_IDLE;
+        bank->programmed_bytes = 0U;
+
+        /* Select the active bank by the commit byte */
+        (void)EEPROM_read_bytes(base_address, &commit, CB_COMMIT_SIZE);
+        bank->active_bank = (commit == CB_COMMIT_BANK_B) ? CB_BANK_B : CB_BANK_A;
+    }
+
+    /* Return Configuration Bank status */
+    return CB_status;
+}
+
+/**
+ * @brief This API is used to read the committed configuration block.
+ * @param bank A pointer to the bank (opened by CB_init).
+ * @param data A pointer to the configuration block (block_size bytes).
+ * @return The configuration block and the status of Configuration Bank (EEPROM_DATA_IS_READ or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t CB_read(cb_bank_t * bank, uint8_t * data)
+{
+    driver_status_t CB_status = DRIVER_IS_OK;
+
+    /* Check if the pointers are null pointers */
+    if ((bank == NULL_PTR) || (data == NULL_PTR))
+    {
+        CB_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        CB_status = EEPROM_read_bytes(CB_BANK_ADDRESS(bank, bank->active_bank), data, bank->block_size);
+    }
+
+    /* Return Configuration Bank status */
+    return CB_status;
+}
+
+/**
+ * @brief This API is used to commit a new configuration block, so after a reset either the previous or the new block
+ * is read and never a mix of them.
+ * @param bank A pointer to the bank (opened by CB_init).
+ * @param data A pointer to the configuration block (block_size bytes), it must not be changed until the commit is completed.
+ * @note The block is written to the inactive bank, read back and verified, then the commit byte is flipped to select it.
+ * @note Nothing is programmed if the block equals the active bank, otherwise only the bytes which differ from the
+ * inactive bank (the configuration before the active one) are programmed.
+ * @note In TIME_TRIGGER_OS, it must be called again with the same block until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of Configuration Bank (EEPROM_DATA_IS_WRITTEN, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN,
+ * CB_BANK_IS_NOT_VERIFIED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t CB_commit(cb_bank_t * bank, uint8_t * data)
+{
+    driver_status_t CB_status = DRIVER_IS_OK;
+    uint16_t copy_programmed = EEPROM_NO_DATA;
+    uint16_t flip_programmed = EEPROM_NO_DATA;
+    uint8_t commit = CB_COMMIT_BANK_A;
+
+    /* Check if the pointers are null pointers */
+    if ((bank == NULL_PTR) || (data == NULL_PTR))
+    {
+        CB_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        CB_status = EEPROM_DATA_IS_WRITTEN;
+
+        /* Check if that is a new commit of a changed block */
+        if (bank->commit_phase == CB_COMMIT_IDLE)
+        {
+            if (CB_compare(CB_BANK_ADDRESS(bank, bank->active_bank), data, bank->block_size) == CB_IS_DIFFERENT)
+            {
+                bank->commit_phase = CB_COMMIT_COPY;
+                bank->commit_data = data;
+                bank->commit_length = EEPROM_NO_DATA;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the block to the inactive bank */
+        if (bank->commit_phase == CB_COMMIT_COPY)
+        {
+            CB_status = EEPROM_update_data(CB_BANK_ADDRESS(bank, CB_OTHER_BANK(bank->active_bank)), bank->commit_data,
+                                           bank->block_size, &(bank->commit_length), &copy_programmed);
+            if (CB_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                /* Verify the inactive bank before it is selected */
+                if (CB_compare(CB_BANK_ADDRESS(bank, CB_OTHER_BANK(bank->active_bank)), bank->commit_data,
+                               bank->block_size) == CB_IS_EQUAL)
+                {
+                    bank->commit_phase = CB_COMMIT_FLIP;
+                    bank->commit_length = EEPROM_NO_DATA;
+                }
+                else
+                {
+                    /* Keep the active bank, the next commit writes the inactive bank again */
+                    bank->commit_phase = CB_COMMIT_IDLE;
+                    CB_status = CB_BANK_IS_NOT_VERIFIED;
+                }
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Flip the commit byte which selects the new block */
+        if (bank->commit_phase == CB_COMMIT_FLIP)
+        {
+            commit = (bank->active_bank == CB_BANK_A) ? CB_COMMIT_BANK_B : CB_COMMIT_BANK_A;
+            CB_status = EEPROM_update_data(bank->base_address, &commit, CB_COMMIT_SIZE, &(bank->commit_length),
+                                           &flip_programmed);
+            if (CB_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                /* The new block is the active one */
+                bank->commit_phase = CB_COMMIT_IDLE;
+                bank->active_bank = CB_OTHER_BANK(bank->active_bank);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Each phase has its own counter, since EEPROM_update_data resets it at the start of the phase */
+        bank->programmed_bytes += (uint32_t)copy_programmed + (uint32_t)flip_programmed;
+    }
+
+    /* Return Configuration Bank status */
+    return CB_status;
+}
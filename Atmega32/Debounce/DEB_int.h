@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 12:52:08                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 12:52:08                              *
+ * @FilePath              : DEB_int.h                                        *
+ ****************************************************************************/
+
+#ifndef DEBOUNCE_DEB_INT_H_
+#define DEBOUNCE_DEB_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+#include "../GPIO/GPIO_int.h"
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t DEB_init      (void);
+driver_status_t DEB_update    (void);
+driver_status_t DEB_get_state (gpio_port_t port, uint8_t * state);
+driver_status_t DEB_get_edges (gpio_port_t port, uint8_t * rising, uint8_t * falling);
+
+#endif
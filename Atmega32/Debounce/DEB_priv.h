@@ -0,0 +1,22 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 12:52:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 12:52:40                              *
+ * @FilePath              : DEB_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef DEBOUNCE_DEB_PRIV_H_
+#define DEBOUNCE_DEB_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Vertical Counters and Edges initial values
+ */
+
+#define DEB_NO_PINS                     0x00U
+
+#endif
@@ -0,0 +1,181 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 12:53:15                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 21:28:00                              *
+ * @FilePath              : DEB_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "../GPIO/GPIO_int.h"
+#include "DEB_int.h"
+#include "DEB_priv.h"
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Debounced levels of all ports pins (bit per pin).
+ */
+static uint8_t DEB_state[PORT_MAX];
+
+/**
+ * @brief Two bits Vertical Counters (bit per pin), a pin changes its debounced level
+ * after 4 successive samples differ from it.
+ */
+static uint8_t DEB_counter_0[PORT_MAX];
+static uint8_t DEB_counter_1[PORT_MAX];
+
+/**
+ * @brief Rising and Falling Edges of the debounced levels since the last read (bit per pin).
+ */
+static uint8_t DEB_rising[PORT_MAX];
+static uint8_t DEB_falling[PORT_MAX];
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to initialize the debouncer by the current levels of all pins.
+ * @note The pins modes must be configured before that API.
+ * @return The status of the Debouncer (DRIVER_IS_OK).
+ */
+driver_status_t DEB_init(void)
+{
+    driver_status_t DEB_status = DRIVER_IS_OK;
+    uint8_t port = 0U;
+
+    /* Set debounced levels by the current levels */
+    DEB_status = GPIO_read_all_ports(DEB_state);
+
+    /* Reset Counters and Edges */
+    for (port = 0U; port < PORT_MAX; port++)
+    {
+        DEB_counter_0[port] = DEB_NO_PINS;
+        DEB_counter_1[port] = DEB_NO_PINS;
+        DEB_rising[port] = DEB_NO_PINS;
+        DEB_falling[port] = DEB_NO_PINS;
+    }
+
+    /* Return Debouncer status */
+    return DEB_status;
+}
+
+/**
+ * @brief This API is used to sample all pins and update their debounced levels.
+ * @note It must be called periodically (e.g. every 5 ms), the debounce time is 4 calls.
+ * @note All 8 pins of a port are processed in parallel by the vertical counters.
+ * @return The status of the Debouncer (DRIVER_IS_OK).
+ */
+driver_status_t DEB_update(void)
+{
+    driver_status_t DEB_status = DRIVER_IS_OK;
+    uint8_t samples[PORT_MAX];
+    uint8_t port = 0U;
+    uint8_t delta = 0U;
+    uint8_t changes = 0U;
+
+    /* Sample all ports */
+    DEB_status = GPIO_read_all_ports(samples);
+
+    for (port = 0U; port < PORT_MAX; port++)
+    {
+        /* Pins whose samples differ from their debounced levels */
+        delta = (uint8_t)(samples[port] ^ DEB_state[port]);
+
+        /* Count the differences, and reset the counters of the pins which are equal to their debounced levels */
+        DEB_counter_1[port] = (uint8_t)((DEB_counter_1[port] ^ DEB_counter_0[port]) & delta);
+        DEB_counter_0[port] = (uint8_t)(~DEB_counter_0[port] & delta);
+
+        /* Pins whose counters rolled over change their debounced levels */
+        changes = (uint8_t)(delta & ~(DEB_counter_0[port] | DEB_counter_1[port]));
+        DEB_state[port] ^= changes;
+
+        /* Store the edges */
+        DEB_rising[port] |= (uint8_t)(changes & DEB_state[port]);
+        DEB_falling[port] |= (uint8_t)(changes & ~DEB_state[port]);
+    }
+
+    /* Return Debouncer status */
+    return DEB_status;
+}
+
+/**
+ * @brief This API is used to get the debounced levels of a port pins.
+ * @param port The Port whose debounced levels will be got (PORT_A -> PORT_D).
+ * @param state A pointer to the debounced levels (bit per pin).
+ * @return The debounced levels and the status of the Debouncer (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t DEB_get_state(gpio_port_t port, uint8_t * state)
+{
+    driver_status_t DEB_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (state == NULL_PTR)
+    {
+        DEB_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the Port is existed or not */
+    else if (port >= PORT_MAX)
+    {
+        DEB_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        *state = DEB_state[port];
+    }
+
+    /* Return Debouncer status */
+    return DEB_status;
+}
+
+/**
+ * @brief This API is used to get and clear the edges of a port pins since the last call.
+ * @param port The Port whose edges will be got (PORT_A -> PORT_D).
+ * @param rising A pointer to the pins which became high (bit per pin).
+ * @param falling A pointer to the pins which became low (bit per pin).
+ * @note The edges are read and cleared with interrupts disabled, so DEB_update can be called from an interrupt.
+ * @return The edges and the status of the Debouncer (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t DEB_get_edges(gpio_port_t port, uint8_t * rising, uint8_t * falling)
+{
+    driver_status_t DEB_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if the pointers are null pointers */
+    if ((rising == NULL_PTR) || (falling == NULL_PTR))
+    {
+        DEB_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the Port is existed or not */
+    else if (port >= PORT_MAX)
+    {
+        DEB_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        /* Save Interrupts state and disable them */
+        ATOMIC_ENTER(sreg_state, ILT_DEB_GET_EDGES);
+
+        /* Get and clear the edges */
+        *rising = DEB_rising[port];
+        *falling = DEB_falling[port];
+        DEB_rising[port] = DEB_NO_PINS;
+        DEB_falling[port] = DEB_NO_PINS;
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_DEB_GET_EDGES);
+    }
+
+    /* Return Debouncer status */
+    return DEB_status;
+}
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
  * @CreatedDate           : 2023-06-27 10:26:29                              *
  * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
- * @LastEditDate          : 2023-06-27 13:15:58                              *
+ * @LastEditDate          : 2026-10-18 03:25:00                              *
  * @FilePath              : EEPROM_cfg.h                                     *
  ****************************************************************************/
 
@@ -24,16 +24,113 @@
 /**
  * @brief OS Configuration
  * @note Options are SUPER_LOOP_OS or TIME_TRIGGER_OS
+ * @note It can be overridden from the compiler command line (-DOS=...), make test does it.
  */
 
+#ifndef OS
 #define OS              SUPER_LOOP_OS
+#endif
 
 /**
  * @brief EEPROM Interrupt Configuration
  * @note Options are EEPROM_INTERRUPT_DISABLE or EERPOM_INTERRUPT_ENABLE
+ * @note It can be overridden from the compiler command line (-DEEPROM_INTERRUPT=...), make test does it.
  */
 
+#ifndef EEPROM_INTERRUPT
 #define EEPROM_INTERRUPT    EEPROM_INTERRUPT_DISABLE
+#endif
+
+/**
+ * @brief EEPROM Wait Mode Configuration
+ * @note Options are EEPROM_WAIT_BUSY_POLL or EEPROM_WAIT_SLEEP
+ * @note It selects how SUPER_LOOP_OS waits for the running EEPROM write, EEPROM_WAIT_SLEEP sleeps in Idle Mode until
+ * EEPROM Ready Interrupt wakes the MCU up, so it needs EERPOM_INTERRUPT_ENABLE.
+ * @note If Global Interrupt is disabled by the caller, EEPROM is polled as sleeping would enable it.
+ * @note It can be overridden from the compiler command line (-DEEPROM_WAIT_MODE=...), make test does it.
+ */
+
+#ifndef EEPROM_WAIT_MODE
+#define EEPROM_WAIT_MODE    EEPROM_WAIT_BUSY_POLL
+#endif
+
+/**
+ * @brief EEPROM Read Budget
+ * @note Maximum number of bytes read by one call of EEPROM_read_xfer (and EEPROM_read_data) in TIME_TRIGGER_OS.
+ * @note Each byte takes about 10 CPU cycles (the CPU is halted 4 cycles by each EEPROM read).
+ * @note Minimum value is 1 and Maximum value is 1024.
+ */
+
+#define EEPROM_READ_BUDGET  32U
+
+/**
+ * @brief EEPROM Asynchronous Write Queue Size
+ * @note Number of bytes that can wait in the queue to be written by EEPROM Ready Interrupt.
+ * @note Used only if EEPROM_INTERRUPT is EERPOM_INTERRUPT_ENABLE.
+ * @note Minimum value is 1 and Maximum value is 255.
+ */
+
+#define EEPROM_ASYNC_QUEUE_SIZE         64U
+
+/**
+ * @brief EEPROM Asynchronous Requests Queue Size
+ * @note Number of asynchronous write requests (with their callbacks) that can be pending at the same time.
+ * @note Used only if EEPROM_INTERRUPT is EERPOM_INTERRUPT_ENABLE.
+ * @note Minimum value is 1 and Maximum value is 255.
+ */
+
+#define EEPROM_ASYNC_REQUESTS_SIZE      4U
+
+/**
+ * @brief EEPROM Cache Configuration
+ * @note Options are EEPROM_CACHE_DISABLE or EEPROM_CACHE_ENABLE
+ * @note If it is enabled, the EEPROM window (EEPROM_CACHE_BASE_ADDRESS -> EEPROM_CACHE_BASE_ADDRESS + EEPROM_CACHE_SIZE - 1)
+ * is shadowed in RAM, EEPROM_cache_read and EEPROM_cache_write access RAM only, and the changed bytes are written back
+ * by EEPROM_flush or EEPROM_cache_drain.
+ * @note It can be overridden from the compiler command line (-DEEPROM_CACHE=...), make test does it.
+ */
+
+#ifndef EEPROM_CACHE
+#define EEPROM_CACHE                    EEPROM_CACHE_DISABLE
+#endif
+
+/**
+ * @brief EEPROM Cache Window
+ * @note EEPROM_CACHE_SIZE bytes of RAM are used for the window and EEPROM_CACHE_SIZE / 8 bytes for its dirty bitmap.
+ * @note The window must be in available EEPROM Space (0 -> 1023).
+ */
+
+#define EEPROM_CACHE_BASE_ADDRESS       0U
+#define EEPROM_CACHE_SIZE               64U
+
+/**
+ * @brief EEPROM Write Coalescing Configuration
+ * @note Options are EEPROM_COALESCE_DISABLE or EEPROM_COALESCE_ENABLE
+ * @note If it is enabled, EEPROM_write_pending keeps the bytes in RAM for EEPROM_COALESCE_HOLD_OFF calls of
+ * EEPROM_process_pending, so the writes to the same address in that window cost one program cycle.
+ * @note It can be overridden from the compiler command line (-DEEPROM_COALESCE=...), make test does it.
+ */
+
+#ifndef EEPROM_COALESCE
+#define EEPROM_COALESCE                 EEPROM_COALESCE_DISABLE
+#endif
+
+/**
+ * @brief EEPROM Write Coalescing Size
+ * @note Number of different addresses that can be pending at the same time (4 bytes of RAM each).
+ * @note Minimum value is 1 and Maximum value is 255.
+ */
+
+#define EEPROM_COALESCE_SIZE            16U
+
+/**
+ * @brief EEPROM Write Coalescing Hold-off
+ * @note Number of EEPROM_process_pending calls from the first pending write of an address to its commit
+ * (e.g. 30 calls every 10 ms hold the bytes for 300 ms).
+ * @note Minimum value is 1 and Maximum value is 255.
+ */
+
+#define EEPROM_COALESCE_HOLD_OFF        30U
 
 /**
  * @brief BOOT LOADER Configuration
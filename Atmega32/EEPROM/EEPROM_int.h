@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-06-27 10:22:06                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2023-08-07 22:42:33                              *
+ * @LastEditDate          : 2026-10-17 23:44:00                              *
  * @FilePath              : EEPROM_int.h                                     *
  ****************************************************************************/
 
@@ -16,6 +16,34 @@
 #include "../../MC_driver.h"
 
 
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief EEPROM Asynchronous Write Completion Callback
+ * @note It is called from EEPROM Ready Interrupt (ISR context) after the last byte of the request has been programmed.
+ * It may call EEPROM_write_async to chain the next request.
+ */
+typedef void (*eeprom_callback_t)(void);
+
+/**
+ * @brief EEPROM Transfer Context
+ * @note It holds the progress of one read or write transfer, so each task can stream its own transfers.
+ * @note The CRC is updated only by EEPROM_write_block_crc and EEPROM_read_block_crc, with the bytes transferred by each
+ * call, so it is computed incrementally across TIME_TRIGGER_OS calls and the plain transfers do not compute it.
+ */
+typedef struct
+{
+    uint16_t        base_address;    /* The start Address of the transfer in EEPROM       */
+    uint16_t        cursor;          /* The number of bytes which have been transferred   */
+    uint16_t        length;          /* The number of bytes of the transfer               */
+    uint8_t *       data;            /* The data of the transfer in RAM                   */
+    driver_status_t status;          /* The last status of the transfer                   */
+    uint16_t        crc;             /* The CRC-16 of the block transferred bytes         */
+}eeprom_xfer_t;
+
+
 /**
  * @section APIs
  */
@@ -24,6 +52,24 @@ driver_status_t EEPROM_init       (void);
 driver_status_t EEPROM_write_byte (uint16_t address, uint8_t byte);
 driver_status_t EEPROM_write_data (uint16_t base_address, uint8_t * data, uint16_t length, uint16_t * actual_length);
 driver_status_t EEPROM_read_data  (uint16_t base_address, uint8_t * data, uint16_t length, uint16_t * actual_length);
+driver_status_t EEPROM_xfer_init  (eeprom_xfer_t * xfer, uint16_t base_address, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_write_xfer (eeprom_xfer_t * xfer);
+driver_status_t EEPROM_read_xfer  (eeprom_xfer_t * xfer);
+driver_status_t EEPROM_read_bytes (uint16_t base_address, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_write_block_crc(eeprom_xfer_t * xfer);
+driver_status_t EEPROM_read_block_crc (eeprom_xfer_t * xfer);
+driver_status_t EEPROM_crc16_update   (uint16_t * crc, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_update_data(uint16_t base_address, uint8_t * data, uint16_t length, uint16_t * actual_length, uint16_t * programmed_length);
+driver_status_t EEPROM_write_async(uint16_t base_address, uint8_t * data, uint16_t length, eeprom_callback_t callback);
+driver_status_t EEPROM_get_queue_depth(uint8_t * depth);
+driver_status_t EEPROM_cache_load (void);
+driver_status_t EEPROM_cache_read (uint16_t address, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_cache_write(uint16_t address, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_cache_drain(void);
+driver_status_t EEPROM_flush      (void);
+driver_status_t EEPROM_write_pending  (uint16_t base_address, uint8_t * data, uint16_t length);
+driver_status_t EEPROM_process_pending(void);
+driver_status_t EEPROM_flush_pending  (void);
 void EEPROM_enable_interrupt      (void);
 void EEPROM_disable_interrupt     (void);
 
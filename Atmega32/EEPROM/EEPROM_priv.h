@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
  * @CreatedDate           : 2023-06-27 10:25:18                              *
  * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
- * @LastEditDate          : 2023-07-02 15:42:28                              *
+ * @LastEditDate          : 2026-10-17 19:12:00                              *
  * @FilePath              : EEPROM_priv.h                                    *
  ****************************************************************************/
 
@@ -27,6 +27,27 @@
 #define EEPROM_INTERRUPT_DISABLE        0U
 #define EERPOM_INTERRUPT_ENABLE         1U
 
+/**
+ * @brief EEPROM Wait Options
+ */
+
+#define EEPROM_WAIT_BUSY_POLL           0U
+#define EEPROM_WAIT_SLEEP               1U
+
+/**
+ * @brief EEPROM Cache Options
+ */
+
+#define EEPROM_CACHE_DISABLE            0U
+#define EEPROM_CACHE_ENABLE             1U
+
+/**
+ * @brief EEPROM Write Coalescing Options
+ */
+
+#define EEPROM_COALESCE_DISABLE         0U
+#define EEPROM_COALESCE_ENABLE          1U
+
 /**
  * @brief Boot Loader Options
  */
@@ -50,7 +71,6 @@
  * @brief Write Condition
  */
 #define EEPROM_WRITE_CONDITION          0U
-#define EEPROM_WRITE_ENABLE_CONDITION   2U
 
 /**
  * @brief Data Register can be processed.
@@ -78,4 +98,77 @@
 
 #define EEPROM_NO_DATA                  0U
 
+/**
+ * @brief Block Read
+ * @note Number of bytes read per iteration of the unrolled loop.
+ */
+
+#define EEPROM_READ_UNROLL              4U
+#define EEPROM_ADDRESS_LOW_MASK         0xFFU
+
+/**
+ * @brief Asynchronous Write Queue
+ * @note The last byte of each request is marked in the unused high bits of its address.
+ */
+
+#define EEPROM_ASYNC_ADDRESS_MASK       0x03FFU
+#define EEPROM_ASYNC_REQUEST_END        0x8000U
+#define EEPROM_ASYNC_QUEUE_EMPTY        0U
+
+/**
+ * @brief Cache Dirty Bitmap (bit per cached byte)
+ */
+
+#define EEPROM_CACHE_BITMAP_SIZE        ((EEPROM_CACHE_SIZE + 7U) / 8U)
+#define EEPROM_CACHE_BITMAP_BYTE(index) ((index) >> 3U)
+#define EEPROM_CACHE_BITMAP_BIT(index)  ((uint8_t)(SET_VALUE << ((index) & 7U)))
+#define EEPROM_CACHE_IS_CLEAN           0x00U
+#define EEPROM_CACHE_LAST_ADDRESS       (EEPROM_CACHE_BASE_ADDRESS + EEPROM_CACHE_SIZE - 1U)
+
+/**
+ * @brief Pending Writes
+ */
+
+#define EEPROM_PENDING_NEW_AGE          0U
+#define EEPROM_PENDING_ANY_AGE          0U
+#define EEPROM_PENDING_EMPTY            0U
+
+/**
+ * @brief Block CRC (CRC-16/CCITT: polynomial 0x1021, initial value 0xFFFF, no final XOR)
+ * @note The CRC is stored after the block (most significant byte first), so the CRC of the block followed by
+ * its CRC is 0 when the block is not corrupted.
+ */
+
+#define EEPROM_CRC_INITIAL              0xFFFFU
+#define EEPROM_CRC_VALID                0x0000U
+#define EEPROM_CRC_SIZE                 2U
+#define EEPROM_CRC_TABLE_SIZE           16U
+#define EEPROM_CRC_NIBBLE_SHIFT         4U
+#define EEPROM_CRC_NIBBLE_MASK          0x0FU
+#define EEPROM_CRC_TOP_NIBBLE_SHIFT     12U
+#define EEPROM_CRC_MOST_BYTE            8U
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Asynchronous Write Queue Entry
+ */
+typedef struct
+{
+    uint16_t address;    /* EEPROM Address (and request end marker) */
+    uint8_t  byte;       /* Data byte to be written                 */
+}eeprom_async_entry_t;
+
+/**
+ * @brief Pending Write Entry
+ */
+typedef struct
+{
+    uint16_t address;    /* EEPROM Address                                                */
+    uint8_t  byte;       /* Newest data byte written to that address                      */
+    uint8_t  age;        /* EEPROM_process_pending calls since its first pending write    */
+}eeprom_pending_entry_t;
+
 #endif
\ No newline at end of file
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-06-27 10:24:09                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2024-01-11 09:41:29                              *
+ * @LastEditDate          : 2026-10-17 23:44:00                              *
  * @FilePath              : EEPROM_prog.c                                    *
  ****************************************************************************/
 
@@ -11,303 +11,1778 @@
  */
 
 #include "../atmega32_reg.h"
+#include "../ModeManager/MM_int.h"
+#include "../IrqLatency/ILT_int.h"
 #include "EEPROM_int.h"
 #include "EEPROM_priv.h"
 #include "EEPROM_cfg.h"
 
+#if (EEPROM_WAIT_MODE == EEPROM_WAIT_SLEEP) && (EEPROM_INTERRUPT != EERPOM_INTERRUPT_ENABLE)
+#error "EEPROM_WAIT_SLEEP needs EERPOM_INTERRUPT_ENABLE so that EEPROM Ready Interrupt wakes the MCU up"
+#endif
+
+#if (EEPROM_READ_BUDGET < 1U) || (EEPROM_READ_BUDGET > (EEPROM_LAST_LOCATION + 1U))
+#error "EEPROM_READ_BUDGET must be 1 -> 1024"
+#endif
+
+#if (EEPROM_CACHE == EEPROM_CACHE_ENABLE) && ((EEPROM_CACHE_SIZE == 0U) || (EEPROM_CACHE_LAST_ADDRESS > EEPROM_LAST_LOCATION))
+#error "EEPROM cache window must be in available EEPROM Space"
+#endif
+
+#if (EEPROM_COALESCE == EEPROM_COALESCE_ENABLE) && ((EEPROM_COALESCE_SIZE < 1U) || (EEPROM_COALESCE_SIZE > 255U) || \
+                                                    (EEPROM_COALESCE_HOLD_OFF < 1U) || (EEPROM_COALESCE_HOLD_OFF > 255U))
+#error "EEPROM_COALESCE_SIZE and EEPROM_COALESCE_HOLD_OFF must be 1 -> 255"
+#endif
+
+/**
+ * @section Global Variables
+ */
+
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+/**
+ * @brief Asynchronous Write Queue which is drained by EEPROM Ready Interrupt (one byte per interrupt).
+ */
+static eeprom_async_entry_t EEPROM_async_queue[EEPROM_ASYNC_QUEUE_SIZE];
+static uint8_t EEPROM_async_head = 0U;
+static uint8_t EEPROM_async_tail = 0U;
+static volatile uint8_t EEPROM_async_count = EEPROM_ASYNC_QUEUE_EMPTY;
+
+/**
+ * @brief Asynchronous Requests Callbacks Queue (one callback per request in the same order of requests).
+ */
+static eeprom_callback_t EEPROM_async_callbacks[EEPROM_ASYNC_REQUESTS_SIZE];
+static uint8_t EEPROM_async_callbacks_head = 0U;
+static uint8_t EEPROM_async_callbacks_tail = 0U;
+static volatile uint8_t EEPROM_async_callbacks_count = EEPROM_ASYNC_QUEUE_EMPTY;
+
+/**
+ * @brief Set when the byte being programmed is the last byte of a request.
+ */
+static volatile uint8_t EEPROM_async_request_done = CLEAR_VALUE;
+
+/**
+ * @brief Set while the queue holds EEPROM Ready resource of Mode Manager (from the first queued request until the
+ * queue is drained), so the MCU only sleeps in modes that EEPROM Ready Interrupt can wake up.
+ */
+static volatile uint8_t EEPROM_async_is_active = CLEAR_VALUE;
+
+/**
+ * @brief Set while a block is read with EEPROM Ready Interrupt masked, so a request which is queued by an ISR meanwhile
+ * leaves the interrupt masked until the end of the block.
+ */
+static volatile uint8_t EEPROM_read_is_active = CLEAR_VALUE;
+#endif
+
+/**
+ * @brief CRC-16/CCITT of each nibble, it is used to update the CRC 4 bits at once.
+ */
+static const uint16_t EEPROM_crc_table[EEPROM_CRC_TABLE_SIZE] FLASH_CONST =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+#if EEPROM_CACHE == EEPROM_CACHE_ENABLE
+/**
+ * @brief EEPROM Cache Window, its dirty bitmap (bit per byte) and the next byte to be checked by the drain.
+ */
+static uint8_t EEPROM_cache[EEPROM_CACHE_SIZE];
+static uint8_t EEPROM_cache_dirty[EEPROM_CACHE_BITMAP_SIZE];
+static uint16_t EEPROM_cache_cursor = 0U;
+#endif
+
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+/**
+ * @brief Pending Writes which are merged in RAM until their hold-off is elapsed (the first EEPROM_pending_count
+ * entries are used).
+ */
+static eeprom_pending_entry_t EEPROM_pending[EEPROM_COALESCE_SIZE];
+static uint8_t EEPROM_pending_count = EEPROM_PENDING_EMPTY;
+#endif
+
+/**
+ * @section Private Functions
+ */
+
+#if OS == SUPER_LOOP_OS
+/**
+ * @brief This function is used to wait until there is no writing process going on.
+ * @note In EEPROM_WAIT_SLEEP, EEWE is checked with Global Interrupt disabled and MM_set_mode_atomic enables it right
+ * before the sleep instruction, so EEPROM Ready Interrupt can not be served between the check and the sleep.
+ */
+static void EEPROM_wait_ready(void)
+{
+#if EEPROM_WAIT_MODE == EEPROM_WAIT_SLEEP
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if Global Interrupt is enabled by the caller */
+    if (((SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE)
+    {
+        /* Check EEWE without interruption */
+        ATOMIC_ENTER(sreg_state, ILT_EEPROM_WAIT_READY);
+        while (((((EEPROM->EECR).bits).EEWE) != EEPROM_DATA_REG_IS_AVAILABLE))
+        {
+            /* EEPROM Ready Interrupt wakes the MCU up when the write is finished */
+            (((EEPROM->EECR).bits).EERIE) = EERPOM_INTERRUPT_ENABLE;
+            IRQ_LATENCY_STOP(ILT_EEPROM_WAIT_READY);
+            (void)MM_set_mode_atomic(IDLE_MODE);
+
+            /* Another interrupt may wake the MCU up, so check EEWE again */
+            ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+            IRQ_LATENCY_START();
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_EEPROM_WAIT_READY);
+    }
+    else
+#endif
+    {
+        /* Wait until EEPROM is ready */
+        while (((((EEPROM->EECR).bits).EEWE) != EEPROM_DATA_REG_IS_AVAILABLE))
+            ;
+    }
+}
+#endif
+
+/**
+ * @brief This function is used to read the byte of the next address of a block.
+ * @param address The Address from which data will be read.
+ * @note EEARH must hold the high byte of the previous address, it is written only when the high byte is changed.
+ * @return The byte stored at the given address.
+ */
+static inline uint8_t EEPROM_read_next(uint16_t address)
+{
+    /* Set the high byte of the Address at the start of each 256 bytes */
+    if ((address & EEPROM_ADDRESS_LOW_MASK) == EEPROM_NO_ADDRESS)
+    {
+        ((EEPROM->EEARH).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_MOST_BYTE));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Set the low byte of the Address and enable EEPROM Read */
+    ((EEPROM->EEARL).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_LEAST_BYTE));
+    (((EEPROM->EECR).bits).EERE) = SET_VALUE;
+
+    /* Return the data */
+    return ((EEPROM->EEDR).reg);
+}
+
+/**
+ * @brief This function is used to read successive bytes from EEPROM with one check of the writing process.
+ * @param address The start Address (the block must be in available EEPROM Space).
+ * @param data A pointer to the read data.
+ * @param length The number of bytes.
+ * @note EEPROM Ready Interrupt is masked during the block, so an asynchronous write can not start between the reads.
+ * After the block, it is enabled again if it was enabled before or if the write queue has been filled meanwhile.
+ * @return The number of read bytes (length, or 0 if there is a writing process going on).
+ */
+static uint16_t EEPROM_read_block(uint16_t address, uint8_t *data, uint16_t length)
+{
+    uint8_t interrupt_state = CLEAR_VALUE;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint16_t index = 0U;
+
+    /* Mask EEPROM Ready Interrupt */
+    ATOMIC_ENTER(sreg_state, ILT_EEPROM_READ_BLOCK);
+    interrupt_state = (((EEPROM->EECR).bits).EERIE);
+    (((EEPROM->EECR).bits).EERIE) = EEPROM_INTERRUPT_DISABLE;
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+    EEPROM_read_is_active = SET_VALUE;
+#endif
+    ATOMIC_EXIT(sreg_state, ILT_EEPROM_READ_BLOCK);
+
+    /* Check if there is a writing process going on */
+    if (((((EEPROM->EECR).bits).EEWE) == EEPROM_DATA_REG_IS_AVAILABLE))
+    {
+        /* Set the high byte of the first Address */
+        ((EEPROM->EEARH).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_MOST_BYTE));
+
+        /* Read EEPROM_READ_UNROLL bytes per iteration */
+        while ((uint16_t)(length - index) >= EEPROM_READ_UNROLL)
+        {
+            data[index] = EEPROM_read_next(address);
+            data[index + 1U] = EEPROM_read_next((uint16_t)(address + 1U));
+            data[index + 2U] = EEPROM_read_next((uint16_t)(address + 2U));
+            data[index + 3U] = EEPROM_read_next((uint16_t)(address + 3U));
+            address = (uint16_t)(address + EEPROM_READ_UNROLL);
+            index = (uint16_t)(index + EEPROM_READ_UNROLL);
+        }
+
+        /* Read the remaining bytes */
+        while (index < length)
+        {
+            data[index] = EEPROM_read_next(address);
+            address++;
+            index++;
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Unmask EEPROM Ready Interrupt (an ISR may have queued a request during the block) */
+    ATOMIC_ENTER(sreg_state, ILT_EEPROM_READ_BLOCK);
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+    EEPROM_read_is_active = CLEAR_VALUE;
+    if (EEPROM_async_is_active == SET_VALUE)
+    {
+        interrupt_state = EERPOM_INTERRUPT_ENABLE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    (((EEPROM->EECR).bits).EERIE) = interrupt_state;
+    ATOMIC_EXIT(sreg_state, ILT_EEPROM_READ_BLOCK);
+
+    return index;
+}
+
+/**
+ * @brief This function is used to start writing a byte if EEPROM is ready.
+ * @param address The Address at which the byte will be written.
+ * @param byte The Byte of data that will be written.
+ * @note EEWE is checked and EEAR, EEDR, EEMWE and EEWE are set with Global Interrupt disabled, so EEPROM Ready Interrupt
+ * can not start a queued byte in between, then Interrupts state is restored.
+ * @return EEPROM_DATA_IS_WRITTEN if the write has been started, DRIVER_IS_OK if EEPROM is busy.
+ */
+static driver_status_t EEPROM_start_write(uint16_t address, uint8_t byte)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Save Interrupts state and disable them */
+    ATOMIC_ENTER(sreg_state, ILT_EEPROM_WRITE_BYTE);
+
+    /* Check if EEPROM is ready to be written */
+    if (
+        ((((EEPROM->EECR).bits).EEWE) == EEPROM_DATA_REG_IS_AVAILABLE)
+#if BOOT_LOADER_USAGE == BOOT_LOADER_IS_USED
+        /* Check if CPU finished programming the Flash */
+        && (((SPMCR->bits).SPMEN) == EEPROM_WRITE_CONDITION)
+#endif
+    )
+    {
+        /* Set the EEPROM Address at which data will be written */
+        ((EEPROM->EEARL).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_LEAST_BYTE));
+        ((EEPROM->EEARH).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_MOST_BYTE));
+
+        /* Set the EEPROM Data */
+        ((EEPROM->EEDR).reg) = byte;
+
+        /* Set EEPROM Master Write Enable (EEWE must be set within 4 cycles after it) */
+        (((EEPROM->EECR).bits).EEMWE) = SET_VALUE;
+
+        /* Set EEPROM Write Enable (keeping EEPROM Ready Interrupt state, it may be draining the write queue) */
+        (((EEPROM->EECR).bits).EEWE) = SET_VALUE;
+
+        EEPROM_status = EEPROM_DATA_IS_WRITTEN;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Restore Interrupts state */
+    ATOMIC_EXIT(sreg_state, ILT_EEPROM_WRITE_BYTE);
+
+    return EEPROM_status;
+}
+
+/**
+ * @brief This function is used to update a CRC-16/CCITT with one byte.
+ * @param crc The CRC of the previous bytes.
+ * @param byte The next byte.
+ * @note The byte is processed as two nibbles by the nibble table (two lookups instead of eight shifts).
+ * @return The updated CRC.
+ */
+static uint16_t EEPROM_crc16_byte(uint16_t crc, uint8_t byte)
+{
+    crc = (uint16_t)((crc << EEPROM_CRC_NIBBLE_SHIFT) ^
+                     FLASH_READ_WORD(&EEPROM_crc_table[(uint8_t)(crc >> EEPROM_CRC_TOP_NIBBLE_SHIFT) ^ (uint8_t)(byte >> EEPROM_CRC_NIBBLE_SHIFT)]));
+    crc = (uint16_t)((crc << EEPROM_CRC_NIBBLE_SHIFT) ^
+                     FLASH_READ_WORD(&EEPROM_crc_table[(uint8_t)(crc >> EEPROM_CRC_TOP_NIBBLE_SHIFT) ^ (uint8_t)(byte & EEPROM_CRC_NIBBLE_MASK)]));
+
+    return crc;
+}
+
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+/**
+ * @brief This function is used to find the pending write of an address.
+ * @param address The EEPROM Address.
+ * @return The index of the pending entry, or EEPROM_pending_count if the address is not pending.
+ */
+static uint8_t EEPROM_find_pending(uint16_t address)
+{
+    uint8_t entry = 0U;
+
+    while ((entry < EEPROM_pending_count) && (EEPROM_pending[entry].address != address))
+    {
+        entry++;
+    }
+
+    return entry;
+}
+
+/**
+ * @brief This function is used to replace the read bytes of a block by their pending bytes.
+ * @param address The start Address of the block.
+ * @param data A pointer to the read bytes.
+ * @param length The number of bytes.
+ */
+static void EEPROM_overlay_pending(uint16_t address, uint8_t *data, uint16_t length)
+{
+    uint8_t entry = 0U;
+
+    for (entry = 0U; entry < EEPROM_pending_count; entry++)
+    {
+        /* Check if the pending address is in the block */
+        if ((uint16_t)(EEPROM_pending[entry].address - address) < length)
+        {
+            data[EEPROM_pending[entry].address - address] = EEPROM_pending[entry].byte;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief This function is used to commit the pending bytes whose age reached the given age without waiting.
+ * @param min_age The minimum age of the committed bytes (EEPROM_PENDING_ANY_AGE commits all of them).
+ * @note Each pending byte is compared with EEPROM first (read with EEPROM Ready Interrupt masked), so a byte which is
+ * written back to its committed value is dropped without a program cycle.
+ * @note It returns as soon as one byte is programmed or a writing process is going on.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN if no pending byte is left, otherwise
+ * EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+static driver_status_t EEPROM_commit_pending(uint8_t min_age)
+{
+    driver_status_t EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+    uint8_t entry = 0U;
+    uint8_t is_busy = CLEAR_VALUE;
+    uint8_t is_done = CLEAR_VALUE;
+    uint8_t stored = CLEAR_VALUE;
+
+    while ((entry < EEPROM_pending_count) && (is_busy == CLEAR_VALUE))
+    {
+        /* Check if the hold-off of the byte is elapsed */
+        if (EEPROM_pending[entry].age >= min_age)
+        {
+            /* Read the byte with EEPROM Ready Interrupt masked (nothing is read if there is a writing process going on) */
+            if (EEPROM_read_block(EEPROM_pending[entry].address, &stored, 1U) == EEPROM_NO_DATA)
+            {
+                /* Continue in the next call */
+                is_busy = SET_VALUE;
+                is_done = CLEAR_VALUE;
+            }
+            /* Program the byte only if EEPROM holds a different value (only one byte is programmed per call) */
+            else if (stored != EEPROM_pending[entry].byte)
+            {
+                is_busy = SET_VALUE;
+                is_done = (EEPROM_write_byte(EEPROM_pending[entry].address, EEPROM_pending[entry].byte) == EEPROM_DATA_IS_WRITTEN) ?
+                          SET_VALUE : CLEAR_VALUE;
+            }
+            else
+            {
+                is_done = SET_VALUE;
+            }
+
+            /* Remove the committed entry by moving the last entry to its place */
+            if (is_done == SET_VALUE)
+            {
+                EEPROM_pending_count--;
+                EEPROM_pending[entry] = EEPROM_pending[EEPROM_pending_count];
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            entry++;
+        }
+    }
+
+    /* Check if all bytes have been committed */
+    EEPROM_status = (EEPROM_pending_count == EEPROM_PENDING_EMPTY) ? EEPROM_DATA_IS_WRITTEN : EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+
+    return EEPROM_status;
+}
+#endif
+
 /**
  * @section Implementation
  */
 
 /**
- * @brief This API is used to Initialize EEPROM with given Configurations (Address, Interrupt state).
- * @return The status of EEPROM (DRIVER_IS_OK or EEPROM_ADDRESS_NOT_AVAILABLE).
+ * @brief This API is used to Initialize EEPROM with given Configurations (Address, Interrupt state).
+ * @return The status of EEPROM (DRIVER_IS_OK or EEPROM_ADDRESS_NOT_AVAILABLE).
+ */
+driver_status_t EEPROM_init(void)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+    /* Check if location is available or not */
+    if (EEPROM_INITIAL_ADDRESS <= EEPROM_LAST_LOCATION)
+    {
+        /* Set EEPROM Initial Address */
+        ((EEPROM->EEARL).reg) = ((uint8_t)(EEPROM_INITIAL_ADDRESS >> EEPROM_ADDRESS_LEAST_BYTE));
+        ((EEPROM->EEARH).reg) = ((uint8_t)(EEPROM_INITIAL_ADDRESS >> EEPROM_ADDRESS_MOST_BYTE));
+    }
+    else
+    {
+        /* EEPROM Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+    /* Set EEPROM Ready Interrupt State */
+    (((EEPROM->EECR).bits).EERIE) = EEPROM_INTERRUPT;
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to write byte of data in specific address in EEPROM.
+ * @param address The Address indicates the location of EEPROM at which data will be written (must be >= 0 and <= 1023).
+ * @param byte Ths Byte of data that will be written in the given address.
+ * @note Global Interrupt is disabled only while EEPROM readiness is checked and EEAR, EEDR, EEMWE and EEWE are set,
+ * then its state is restored, so it is never enabled if it has been disabled by the caller.
+ * @note In SUPER_LOOP_OS, if EEPROM Ready Interrupt starts a queued byte before the write, it waits again.
+ * @return The status of EEPROM (EEPROM_ADDRESS_NOT_AVAILABLE or EEPROM_DATA_IS_WRITTEN).
+ */
+driver_status_t EEPROM_write_byte(uint16_t address, uint8_t byte)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+    /* Check if the address in available EEPROM Space */
+    if (address > EEPROM_LAST_LOCATION)
+    {
+        /* Update Driver Error value */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+    else
+    {
+        do
+        {
+            /* Wait until EEPROM is ready to be written */
+            EEPROM_wait_ready();
+#if BOOT_LOADER_USAGE == BOOT_LOADER_IS_USED
+            /* Wait until CPU finished programming the Flash */
+            while (((SPMCR->bits).SPMEN) != EEPROM_WRITE_CONDITION)
+                ;
+#endif
+            /* Start writing the byte */
+            EEPROM_status = EEPROM_start_write(address, byte);
+        } while (EEPROM_status != EEPROM_DATA_IS_WRITTEN);
+    }
+#elif OS == TIME_TRIGGER_OS
+    else
+    {
+        /* Start writing the byte if EEPROM is ready */
+        EEPROM_status = EEPROM_start_write(address, byte);
+    }
+#endif
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to prepare a transfer context for EEPROM_write_xfer or EEPROM_read_xfer.
+ * @param xfer A pointer to the transfer context which is owned by the caller.
+ * @param base_address The start Address of the transfer in EEPROM.
+ * @param data A pointer to data that will be written to or read from EEPROM.
+ * @param length The length of data of the transfer.
+ * @note Each task can own its transfer contexts, so many transfers can be streamed at the same time.
+ * @return The status of EEPROM (DRIVER_IS_OK, EEPROM_ADDRESS_NOT_AVAILABLE or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_xfer_init(eeprom_xfer_t *xfer, uint16_t base_address, uint8_t *data, uint16_t length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+    /* Check if the pointers are null pointers */
+    if ((xfer == NULL_PTR) || (data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Check if the Base Address is available or not */
+        if (base_address > EEPROM_LAST_LOCATION)
+        {
+            /* EEPROM Base Address is not available */
+            EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Set the transfer context */
+        xfer->base_address = base_address;
+        xfer->cursor = EEPROM_NO_DATA;
+        xfer->length = length;
+        xfer->data = data;
+        xfer->status = EEPROM_status;
+        xfer->crc = EEPROM_CRC_INITIAL;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to continue writing the data of a transfer context in successive addresses in EEPROM.
+ * @param xfer A pointer to the transfer context (prepared by EEPROM_xfer_init).
+ * @note In SUPER_LOOP_OS, all the remaining data is written, in TIME_TRIGGER_OS, at most one byte is written per call.
+ * @return The updated transfer cursor and the status of EEPROM (EEPROM_DATA_IS_WRITTEN, EEPROM_ADDRESS_NOT_AVAILABLE,
+ * EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_write_xfer(eeprom_xfer_t *xfer)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+    /* Check if the pointers are null pointers */
+    if ((xfer == NULL_PTR) || (xfer->data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Check if the Base Address is available or not */
+        if (xfer->base_address <= EEPROM_LAST_LOCATION)
+        {
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+            while
+#elif OS == TIME_TRIGGER_OS
+            if
+#endif
+                /* Check if there is still data need to be written and
+                there is still locations available in EEPROM */
+                ((xfer->cursor < xfer->length) && (xfer->cursor <= (EEPROM_LAST_LOCATION - xfer->base_address)))
+            {
+                /* Write data of the current index and check if it is written or not */
+                if (EEPROM_write_byte((uint16_t)(xfer->base_address + xfer->cursor), xfer->data[xfer->cursor]) == EEPROM_DATA_IS_WRITTEN)
+                {
+                    /* Update the cursor */
+                    xfer->cursor++;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+
+            /* Check if all data has been written */
+            if (xfer->cursor >= xfer->length)
+            {
+                /* All Data has been written */
+                EEPROM_status = EEPROM_DATA_IS_WRITTEN;
+            }
+            else
+            {
+                /* Not All Data has been written */
+                EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+            }
+        }
+        else
+        {
+            /* EEPROM Base Address is not available */
+            EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        }
+
+        /* Store the transfer status */
+        xfer->status = EEPROM_status;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to continue reading the data of a transfer context from successive addresses in EEPROM.
+ * @param xfer A pointer to the transfer context (prepared by EEPROM_xfer_init).
+ * @note In SUPER_LOOP_OS, all the remaining data is read, in TIME_TRIGGER_OS, at most EEPROM_READ_BUDGET bytes are read per call.
+ * @note The writing process is checked once per call and EEARH is written only when the high byte of the address is changed.
+ * @return The updated transfer cursor and the status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_ADDRESS_NOT_AVAILABLE,
+ * EEPROM_DATA_IS_NOT_COMPLETELY_READ or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_read_xfer(eeprom_xfer_t *xfer)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t count = EEPROM_NO_DATA;
+    uint16_t read_count = EEPROM_NO_DATA;
+
+    /* Check if the pointers are null Pointers */
+    if ((xfer == NULL_PTR) || (xfer->data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Check if the Base Address is available or not */
+        if (xfer->base_address <= EEPROM_LAST_LOCATION)
+        {
+            /* Get the bytes which still need to be read and are in available EEPROM Space */
+            count = (uint16_t)(xfer->length - xfer->cursor);
+            if ((xfer->cursor >= xfer->length) || (xfer->cursor > (EEPROM_LAST_LOCATION - xfer->base_address)))
+            {
+                count = EEPROM_NO_DATA;
+            }
+            else if (count > (uint16_t)(EEPROM_LAST_LOCATION - xfer->base_address - xfer->cursor + 1U))
+            {
+                count = (uint16_t)(EEPROM_LAST_LOCATION - xfer->base_address - xfer->cursor + 1U);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+/* Check which OS is used */
+#if OS == TIME_TRIGGER_OS
+            /* Read EEPROM_READ_BUDGET bytes per call at most */
+            if (count > EEPROM_READ_BUDGET)
+            {
+                count = EEPROM_READ_BUDGET;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+#endif
+
+            if (count != EEPROM_NO_DATA)
+            {
+                /* Read the block with one check of the writing process */
+                read_count = EEPROM_read_block((uint16_t)(xfer->base_address + xfer->cursor), &(xfer->data[xfer->cursor]), count);
+#if OS == SUPER_LOOP_OS
+                /* Wait until there is no writing process going on */
+                while (read_count == EEPROM_NO_DATA)
+                {
+                    EEPROM_wait_ready();
+                    read_count = EEPROM_read_block((uint16_t)(xfer->base_address + xfer->cursor), &(xfer->data[xfer->cursor]), count);
+                }
+#endif
+
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+                /* Return the pending bytes instead of the committed ones */
+                EEPROM_overlay_pending((uint16_t)(xfer->base_address + xfer->cursor), &(xfer->data[xfer->cursor]), read_count);
+#endif
+
+                /* Update the cursor */
+                xfer->cursor = (uint16_t)(xfer->cursor + read_count);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Check if all data has been read */
+            if (xfer->cursor >= xfer->length)
+            {
+                /* All Data has been read */
+                EEPROM_status = EEPROM_DATA_IS_READ;
+            }
+            else
+            {
+                /* Not All Data has been read */
+                EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_READ;
+            }
+        }
+        else
+        {
+            /* EEPROM Base Address is not available */
+            EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        }
+
+        /* Store the transfer status */
+        xfer->status = EEPROM_status;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to read successive bytes from EEPROM until all of them are read.
+ * @param base_address The start Address in EEPROM.
+ * @param data A pointer to the read data.
+ * @param length The number of bytes.
+ * @note It returns after all bytes are read in both OS modes (in TIME_TRIGGER_OS, it runs EEPROM_read_xfer until the
+ * transfer is completed), so it is meant for short reads such as headers and records.
+ * @note Nothing is read if the bytes are not all in available EEPROM Space.
+ * @return The status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_ADDRESS_NOT_AVAILABLE or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_read_bytes(uint16_t base_address, uint8_t *data, uint16_t length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    eeprom_xfer_t xfer;
+
+    EEPROM_status = EEPROM_xfer_init(&xfer, base_address, data, length);
+
+    /* Check if all the data is in available EEPROM Space, otherwise the transfer is never completed */
+    if ((EEPROM_status == DRIVER_IS_OK) && (length != EEPROM_NO_DATA) && ((length - 1U) > (EEPROM_LAST_LOCATION - base_address)))
+    {
+        /* EEPROM Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+    else if (EEPROM_status == DRIVER_IS_OK)
+    {
+        /* In TIME_TRIGGER_OS, EEPROM_READ_BUDGET bytes are read per call at most */
+        do
+        {
+            EEPROM_status = EEPROM_read_xfer(&xfer);
+        } while (EEPROM_status == EEPROM_DATA_IS_NOT_COMPLETELY_READ);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to continue writing a block of a transfer context followed by its CRC-16.
+ * @param xfer A pointer to the transfer context (prepared by EEPROM_xfer_init with the length of the block).
+ * @note The block uses length + 2 successive addresses, the CRC is stored after the data (most significant byte first).
+ * @note In TIME_TRIGGER_OS, at most one byte is written per call, so it must be called until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN, EEPROM_ADDRESS_NOT_AVAILABLE
+ * or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_write_block_crc(eeprom_xfer_t *xfer)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t start = EEPROM_NO_DATA;
+    uint8_t crc_byte = CLEAR_VALUE;
+
+    /* Check if the pointers are null pointers */
+    if ((xfer == NULL_PTR) || (xfer->data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the block and its CRC are in available EEPROM Space */
+    else if ((xfer->base_address > EEPROM_LAST_LOCATION) ||
+             ((uint16_t)(xfer->length + EEPROM_CRC_SIZE - 1U) > (EEPROM_LAST_LOCATION - xfer->base_address)))
+    {
+        /* EEPROM Base Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        xfer->status = EEPROM_status;
+    }
+    else
+    {
+        /* Write the data, then update the CRC with the bytes written by this call */
+        if (xfer->cursor < xfer->length)
+        {
+            start = xfer->cursor;
+            EEPROM_status = EEPROM_write_xfer(xfer);
+            (void)EEPROM_crc16_update(&(xfer->crc), &(xfer->data[start]), (uint16_t)(xfer->cursor - start));
+        }
+        else
+        {
+            EEPROM_status = EEPROM_DATA_IS_WRITTEN;
+        }
+
+        /* Check if all data has been written */
+        if (EEPROM_status == EEPROM_DATA_IS_WRITTEN)
+        {
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+            while
+#elif OS == TIME_TRIGGER_OS
+            if
+#endif
+                /* Check if there is still CRC bytes need to be written */
+                (xfer->cursor < (uint16_t)(xfer->length + EEPROM_CRC_SIZE))
+            {
+                /* Get the CRC byte of the current index (most significant byte first) */
+                crc_byte = (xfer->cursor == xfer->length) ? (uint8_t)(xfer->crc >> EEPROM_CRC_MOST_BYTE) : (uint8_t)(xfer->crc);
+
+                /* Write the CRC byte and check if it is written or not */
+                if (EEPROM_write_byte((uint16_t)(xfer->base_address + xfer->cursor), crc_byte) == EEPROM_DATA_IS_WRITTEN)
+                {
+                    /* Update the cursor */
+                    xfer->cursor++;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+
+            /* Check if the CRC has been written */
+            EEPROM_status = (xfer->cursor >= (uint16_t)(xfer->length + EEPROM_CRC_SIZE)) ? EEPROM_DATA_IS_WRITTEN : EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Store the transfer status */
+        xfer->status = EEPROM_status;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to continue reading a block of a transfer context and check its CRC-16.
+ * @param xfer A pointer to the transfer context (prepared by EEPROM_xfer_init with the length of the block).
+ * @note The CRC is updated with the bytes read by each call, then with the stored CRC, so the block is valid if the result is 0.
+ * @note In TIME_TRIGGER_OS, at most EEPROM_READ_BUDGET bytes of data or one byte of the CRC are read per call, so it must
+ * be called until EEPROM_DATA_IS_READ or EEPROM_CRC_MISMATCH is returned.
+ * @return The data and the status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_CRC_MISMATCH if the block is corrupted or has not
+ * been completely written, EEPROM_DATA_IS_NOT_COMPLETELY_READ, EEPROM_ADDRESS_NOT_AVAILABLE or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_read_block_crc(eeprom_xfer_t *xfer)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t start = EEPROM_NO_DATA;
+    uint8_t crc_byte = CLEAR_VALUE;
+
+    /* Check if the pointers are null pointers */
+    if ((xfer == NULL_PTR) || (xfer->data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the block and its CRC are in available EEPROM Space */
+    else if ((xfer->base_address > EEPROM_LAST_LOCATION) ||
+             ((uint16_t)(xfer->length + EEPROM_CRC_SIZE - 1U) > (EEPROM_LAST_LOCATION - xfer->base_address)))
+    {
+        /* EEPROM Base Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        xfer->status = EEPROM_status;
+    }
+    else
+    {
+        /* Read the data, then update the CRC with the bytes read by this call */
+        if (xfer->cursor < xfer->length)
+        {
+            start = xfer->cursor;
+            EEPROM_status = EEPROM_read_xfer(xfer);
+            (void)EEPROM_crc16_update(&(xfer->crc), &(xfer->data[start]), (uint16_t)(xfer->cursor - start));
+        }
+        else
+        {
+            EEPROM_status = EEPROM_DATA_IS_READ;
+        }
+
+        /* Check if all data has been read */
+        if (EEPROM_status == EEPROM_DATA_IS_READ)
+        {
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+            while
+#elif OS == TIME_TRIGGER_OS
+            if
+#endif
+                /* Check if there is still CRC bytes need to be read */
+                (xfer->cursor < (uint16_t)(xfer->length + EEPROM_CRC_SIZE))
+            {
+                /* Read the stored CRC byte with EEPROM Ready Interrupt masked (nothing is read if there is a writing process going on) */
+                if (EEPROM_read_block((uint16_t)(xfer->base_address + xfer->cursor), &crc_byte, 1U) != EEPROM_NO_DATA)
+                {
+                    /* Update the CRC with the stored CRC byte and the cursor */
+                    xfer->crc = EEPROM_crc16_byte(xfer->crc, crc_byte);
+                    xfer->cursor++;
+                }
+                else
+                {
+#if OS == SUPER_LOOP_OS
+                    /* Wait until there is no writing process going on, then read again */
+                    EEPROM_wait_ready();
+#elif OS == TIME_TRIGGER_OS
+                    /* Continue in the next call */
+#endif
+                }
+            }
+
+            /* Check if the CRC has been read */
+            if (xfer->cursor >= (uint16_t)(xfer->length + EEPROM_CRC_SIZE))
+            {
+                /* Check the CRC of the block */
+                EEPROM_status = (xfer->crc == EEPROM_CRC_VALID) ? EEPROM_DATA_IS_READ : EEPROM_CRC_MISMATCH;
+            }
+            else
+            {
+                /* Not All Data has been read */
+                EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_READ;
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Store the transfer status */
+        xfer->status = EEPROM_status;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to update a CRC-16/CCITT with successive bytes in RAM.
+ * @param crc A pointer to the CRC, it must be 0xFFFF before the first bytes.
+ * @param data A pointer to the bytes.
+ * @param length The number of bytes.
+ * @note It computes the same CRC as EEPROM_write_block_crc, so a block can be checked or built in parts.
+ * @return The updated CRC and the status of EEPROM (DRIVER_IS_OK or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_crc16_update(uint16_t *crc, uint8_t *data, uint16_t length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t index = 0U;
+
+    /* Check if the pointers are null pointers */
+    if ((crc == NULL_PTR) || (data == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        for (index = 0U; index < length; index++)
+        {
+            *crc = EEPROM_crc16_byte(*crc, data[index]);
+        }
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to write more than byte of data in successive addresses in EEPROM.
+ * @param base_address The start Address at which data will be written.
+ * @param data A pointer to data that will be written in the given addresses in EEPROM.
+ * @param length The length of data that wanted to be written in EEPROM.
+ * @param actual_length A pointer to length of data that has been actually written in EEPROM.
+ * @note The caller keeps the progress in actual_length (set to 0 for a new data block), so there is no shared state between calls.
+ * @return The Actual length of data that has been written in EEPROM and
+ * the status of EEPROM (EEPROM_DATA_IS_WRITTEN, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_write_data(uint16_t base_address, uint8_t *data, uint16_t length, uint16_t *actual_length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    eeprom_xfer_t xfer;
+
+    /* Check if the pointers are null pointers */
+    if ((data == NULL_PTR) || (actual_length == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Continue the transfer from the actual length */
+        EEPROM_status = EEPROM_xfer_init(&xfer, base_address, data, length);
+        xfer.cursor = *actual_length;
+
+        if (EEPROM_status == DRIVER_IS_OK)
+        {
+            EEPROM_status = EEPROM_write_xfer(&xfer);
+            *actual_length = xfer.cursor;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to read 1 byte or more successive bytes from EEPROM.
+ * @param base_address The start Address from which data will be read.
+ * @param data A pointer to data that will be read from the given addresses in EEPROM.
+ * @param length The length of data that wanted to be read from EEPROM.
+ * @param actual_length A pointer to length of data that has been actually read from EEPROM.
+ * @note The caller keeps the progress in actual_length (set to 0 for a new data block), so there is no shared state between calls.
+ * @return The Actual length of data that has been read in EEPROM and
+ * the status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_DATA_IS_NOT_COMPLETELY_READ or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_read_data(uint16_t base_address, uint8_t *data, uint16_t length, uint16_t *actual_length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    eeprom_xfer_t xfer;
+
+    /* Check if the pointers are null Pointers */
+    if ((data == NULL_PTR) || (actual_length == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Continue the transfer from the actual length */
+        EEPROM_status = EEPROM_xfer_init(&xfer, base_address, data, length);
+        xfer.cursor = *actual_length;
+
+        if (EEPROM_status == DRIVER_IS_OK)
+        {
+            EEPROM_status = EEPROM_read_xfer(&xfer);
+            *actual_length = xfer.cursor;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to update successive addresses in EEPROM by writing only the bytes that differ from the given data.
+ * @param base_address The start Address at which data will be updated.
+ * @param data A pointer to data that will be stored in the given addresses in EEPROM.
+ * @param length The length of data that wanted to be stored in EEPROM.
+ * @param actual_length A pointer to length of data that has been actually checked and stored in EEPROM.
+ * @param programmed_length A pointer to number of bytes that actually needed a write cycle.
+ * @note *actual_length is the resume cursor of the update, so the caller must set it to 0 before the first call and
+ * keep it between the calls; *programmed_length is reset by the first call (*actual_length is 0), then accumulated.
+ * @note Each location is read first (with EEPROM Ready Interrupt masked), and the write cycle is skipped if it already
+ * holds the same value.
+ * @note In TIME_TRIGGER_OS, all unchanged bytes are skipped and at most one byte is programmed per call.
+ * @return The Actual length of data that has been stored, the number of programmed bytes and
+ * the status of EEPROM (EEPROM_DATA_IS_WRITTEN, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_update_data(uint16_t base_address, uint8_t *data, uint16_t length, uint16_t *actual_length, uint16_t *programmed_length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t location = EEPROM_NO_ADDRESS;
+    uint8_t is_busy = CLEAR_VALUE;
+    uint8_t stored = CLEAR_VALUE;
+
+    /* Check if the pointers are null pointers */
+    if ((data == NULL_PTR) || (actual_length == NULL_PTR) || (programmed_length == NULL_PTR))
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the Base Address is available or not */
+    else if (base_address <= EEPROM_LAST_LOCATION)
+    {
+        /* Check if it is the first call of the update */
+        if (*actual_length == 0U)
+        {
+            /* Reset the programmed length */
+            *programmed_length = 0U;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Set the next location by the base address and the already stored length */
+        location = base_address + *actual_length;
+
+        /* Check if there is still data need to be stored and
+        there is still locations available in EEPROM */
+        while ((*actual_length < length) && (location <= EEPROM_LAST_LOCATION) && (is_busy == CLEAR_VALUE))
+        {
+            /* Read the location with EEPROM Ready Interrupt masked, so a queued byte can not be started in between */
+            if (EEPROM_read_block(location, &stored, 1U) == EEPROM_NO_DATA)
+            {
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+                /* Wait until there is no writing process going on, then read again */
+                EEPROM_wait_ready();
+#elif OS == TIME_TRIGGER_OS
+                /* Continue in the next call */
+                is_busy = SET_VALUE;
+#endif
+            }
+            /* Check if the location already holds the same value */
+            else if (stored == data[*actual_length])
+            {
+                /* Skip the location */
+                location++;
+                (*actual_length)++;
+            }
+            else if (EEPROM_write_byte(location, data[*actual_length]) == EEPROM_DATA_IS_WRITTEN)
+            {
+                /* Update next Location */
+                location++;
+                /* Update the actual and programmed lengths */
+                (*actual_length)++;
+                (*programmed_length)++;
+            }
+            else
+            {
+                /* Continue in the next call */
+                is_busy = SET_VALUE;
+            }
+        }
+
+        /* Check if all data has been stored */
+        if (*actual_length >= length)
+        {
+            /* All Data has been written */
+            EEPROM_status = EEPROM_DATA_IS_WRITTEN;
+        }
+        else
+        {
+            /* Not All Data has been written */
+            EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+        }
+    }
+    else
+    {
+        /* EEPROM Base Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+/**
+ * @brief This API is used to queue data to be written in successive addresses in EEPROM without waiting.
+ * @param base_address The start Address at which data will be written.
+ * @param data A pointer to data that will be copied to the write queue.
+ * @param length The length of data that wanted to be written in EEPROM (must fit in the free space of the queue).
+ * @param callback A function which is called after the last byte has been programmed (can be NULL_PTR).
+ * @note The bytes are written by EEPROM Ready Interrupt one byte per interrupt, so Global Interrupt must be enabled.
+ * @note The whole request is rejected if there is no space for all of its bytes.
+ * @note The queue is filled with Interrupts disabled, so it can be called from an ISR or from a callback (which runs in
+ * the context of EEPROM Ready Interrupt) to chain the requests.
+ * @return The status of EEPROM (EEPROM_DATA_IS_QUEUED, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_QUEUE_IS_FULL,
+ * VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_write_async(uint16_t base_address, uint8_t *data, uint16_t length, eeprom_callback_t callback)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t index = 0U;
+    uint8_t head = 0U;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if the pointer is null pointer */
+    if (data == NULL_PTR)
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if there is data to be written */
+    else if (length == EEPROM_NO_DATA)
+    {
+        /* Empty requests are not accepted */
+        EEPROM_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    /* Check if all the data is in available EEPROM Space */
+    else if ((base_address > EEPROM_LAST_LOCATION) || ((length - 1U) > (EEPROM_LAST_LOCATION - base_address)))
+    {
+        /* EEPROM Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+    else
+    {
+        /* Save Interrupts state and disable them while the queue is filled (the callbacks may queue requests) */
+        ATOMIC_ENTER(sreg_state, ILT_EEPROM_WRITE_ASYNC);
+
+        /* Check if there is space for the data and for the request */
+        if ((length > (uint16_t)(EEPROM_ASYNC_QUEUE_SIZE - EEPROM_async_count)) ||
+            (EEPROM_async_callbacks_count >= EEPROM_ASYNC_REQUESTS_SIZE))
+        {
+            /* Queue has no space for that request */
+            EEPROM_status = EEPROM_QUEUE_IS_FULL;
+        }
+        else
+        {
+            /* Copy data to the free entries of the queue */
+            head = EEPROM_async_head;
+            for (index = 0U; index < length; index++)
+            {
+                EEPROM_async_queue[head].address = (uint16_t)(base_address + index);
+                EEPROM_async_queue[head].byte = data[index];
+                head = (uint8_t)((head + 1U) % EEPROM_ASYNC_QUEUE_SIZE);
+            }
+
+            /* Mark last byte of the request */
+            EEPROM_async_queue[(uint8_t)((head + EEPROM_ASYNC_QUEUE_SIZE - 1U) % EEPROM_ASYNC_QUEUE_SIZE)].address |= EEPROM_ASYNC_REQUEST_END;
+
+            /* Store the request callback */
+            EEPROM_async_callbacks[EEPROM_async_callbacks_head] = callback;
+            EEPROM_async_callbacks_head = (uint8_t)((EEPROM_async_callbacks_head + 1U) % EEPROM_ASYNC_REQUESTS_SIZE);
+            EEPROM_async_callbacks_count++;
+
+            /* Publish the queued bytes */
+            EEPROM_async_head = head;
+            EEPROM_async_count = (uint8_t)(EEPROM_async_count + length);
+
+            /* Keep EEPROM Ready wake-up source until the queue is drained */
+            if (EEPROM_async_is_active == CLEAR_VALUE)
+            {
+                EEPROM_async_is_active = SET_VALUE;
+                (void)MM_acquire(MM_EEPROM_READY_RESOURCE);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Enable EEPROM Ready Interrupt to start draining the queue (a block read enables it at its end) */
+            if (EEPROM_read_is_active == CLEAR_VALUE)
+            {
+                (((EEPROM->EECR).bits).EERIE) = EERPOM_INTERRUPT_ENABLE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Data is queued */
+            EEPROM_status = EEPROM_DATA_IS_QUEUED;
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_EEPROM_WRITE_ASYNC);
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to get the number of bytes still waiting in the asynchronous write queue.
+ * @param depth A pointer to the number of queued bytes.
+ * @return The depth of the queue and the status of EEPROM (DRIVER_IS_OK or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_get_queue_depth(uint8_t *depth)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (depth == NULL_PTR)
+    {
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Get number of queued bytes */
+        *depth = EEPROM_async_count;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief EEPROM Ready Interrupt Service Routine.
+ * @note It writes one queued byte per interrupt and notifies the request owner after its last byte has been programmed.
+ * @note It disables EEPROM Ready Interrupt when the queue is empty as the interrupt is fired as long as EEPROM is ready.
+ */
+ISR(EE_RDY_VECT)
+{
+    eeprom_async_entry_t entry;
+    eeprom_callback_t callback = NULL_PTR;
+
+    /* Stamp the wake-up time if the MCU was sleeping */
+    MM_mark_wakeup();
+
+    /* Check if the previous programmed byte was the last byte of a request */
+    if (EEPROM_async_request_done == SET_VALUE)
+    {
+        EEPROM_async_request_done = CLEAR_VALUE;
+
+        /* Get the request callback */
+        callback = EEPROM_async_callbacks[EEPROM_async_callbacks_tail];
+        EEPROM_async_callbacks_tail = (uint8_t)((EEPROM_async_callbacks_tail + 1U) % EEPROM_ASYNC_REQUESTS_SIZE);
+        EEPROM_async_callbacks_count--;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Check if there is still data in the queue */
+    if (EEPROM_async_count != EEPROM_ASYNC_QUEUE_EMPTY)
+    {
+        /* Get the next entry */
+        entry = EEPROM_async_queue[EEPROM_async_tail];
+        EEPROM_async_tail = (uint8_t)((EEPROM_async_tail + 1U) % EEPROM_ASYNC_QUEUE_SIZE);
+        EEPROM_async_count--;
+
+        /* Set the EEPROM Address at which data will be written */
+        ((EEPROM->EEARL).reg) = ((uint8_t)((entry.address & EEPROM_ASYNC_ADDRESS_MASK) >> EEPROM_ADDRESS_LEAST_BYTE));
+        ((EEPROM->EEARH).reg) = ((uint8_t)((entry.address & EEPROM_ASYNC_ADDRESS_MASK) >> EEPROM_ADDRESS_MOST_BYTE));
+
+        /* Set the EEPROM Data */
+        ((EEPROM->EEDR).reg) = entry.byte;
+
+        /* Set EEPROM Master Write Enable then EEPROM Write Enable (keeping EEPROM Ready Interrupt enabled) */
+        (((EEPROM->EECR).bits).EEMWE) = SET_VALUE;
+        (((EEPROM->EECR).bits).EEWE) = SET_VALUE;
+
+        /* Check if that is the last byte of the request */
+        if ((entry.address & EEPROM_ASYNC_REQUEST_END) != EEPROM_NO_ADDRESS)
+        {
+            EEPROM_async_request_done = SET_VALUE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    /* Check if the last request is finished */
+    else if (EEPROM_async_request_done == CLEAR_VALUE)
+    {
+        /* Disable EEPROM Ready Interrupt until new data is queued */
+        (((EEPROM->EECR).bits).EERIE) = EEPROM_INTERRUPT_DISABLE;
+
+        /* Release EEPROM Ready wake-up source */
+        if (EEPROM_async_is_active == SET_VALUE)
+        {
+            EEPROM_async_is_active = CLEAR_VALUE;
+            (void)MM_release(MM_EEPROM_READY_RESOURCE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Wait for the last byte to be programmed */
+    }
+
+    /* Notify the owner of the finished request */
+    if (callback != NULL_PTR)
+    {
+        callback();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+#if EEPROM_CACHE == EEPROM_CACHE_ENABLE
+/**
+ * @brief This API is used to load the cache window from EEPROM and mark all its bytes as clean.
+ * @note It must be called once before the other cache APIs, it waits until there is no writing process going on.
+ * @return The status of EEPROM (EEPROM_DATA_IS_READ).
  */
-driver_status_t EEPROM_init(void)
+driver_status_t EEPROM_cache_load(void)
 {
     driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t index = 0U;
 
-    /* Check if location is available or not */
-    if (EEPROM_INITIAL_ADDRESS <= EEPROM_LAST_LOCATION)
-    {
-        /* Set EEPROM Initial Address */
-        ((EEPROM->EEARL).reg) = ((uint8_t)(EEPROM_INITIAL_ADDRESS >> EEPROM_ADDRESS_LEAST_BYTE));
-        ((EEPROM->EEARH).reg) = ((uint8_t)(EEPROM_INITIAL_ADDRESS >> EEPROM_ADDRESS_MOST_BYTE));
-    }
-    else
+    /* Copy the window to RAM with EEPROM Ready Interrupt masked, wait until there is no writing process going on */
+    while (EEPROM_read_block(EEPROM_CACHE_BASE_ADDRESS, EEPROM_cache, EEPROM_CACHE_SIZE) == EEPROM_NO_DATA)
+        ;
+
+    /* Mark all bytes as clean */
+    for (index = 0U; index < EEPROM_CACHE_BITMAP_SIZE; index++)
     {
-        /* EEPROM Address is not available */
-        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        EEPROM_cache_dirty[index] = EEPROM_CACHE_IS_CLEAN;
     }
-    /* Set EEPROM Ready Interrupt State */
-    (((EEPROM->EECR).bits).EERIE) = EEPROM_INTERRUPT;
+    EEPROM_cache_cursor = 0U;
+
+    /* Window is read */
+    EEPROM_status = EEPROM_DATA_IS_READ;
 
     /* Return EEPROM status */
     return EEPROM_status;
 }
 
 /**
- * @brief This API is used to write byte of data in specific address in EEPROM.
- * @param address The Address indicates the location of EEPROM at which data will be written (must be >= 0 and <= 1023).
- * @param byte Ths Byte of data that will be written in the given address.
- * @return The status of EEPROM (EEPROM_ADDRESS_NOT_AVAILABLE or EEPROM_DATA_IS_WRITTEN).
+ * @brief This API is used to read successive bytes of the cache window from RAM.
+ * @param address The start Address of data in EEPROM.
+ * @param data A pointer to the read data.
+ * @param length The length of data.
+ * @note The data includes the bytes which have been written by EEPROM_cache_write and are not written back yet.
+ * @return The data and the status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_ADDRESS_IS_NOT_CACHED or PTR_USED_IS_NULL_PTR).
  */
-driver_status_t EEPROM_write_byte(uint16_t address, uint8_t byte)
+driver_status_t EEPROM_cache_read(uint16_t address, uint8_t *data, uint16_t length)
 {
     driver_status_t EEPROM_status = DRIVER_IS_OK;
-/* Check which OS is used */
-#if OS == SUPER_LOOP_OS
-    /* Wait until EEPROM is ready to be written */
-    while (((((EEPROM->EECR).bits).EEWE) != EEPROM_DATA_REG_IS_AVAILABLE))
+    uint16_t index = 0U;
+
+    /* Check if the pointer is null pointer */
+    if (data == NULL_PTR)
     {
-#if BOOT_LOADER_USAGE == BOOT_LOADER_IS_USED
-        /* Wait until CPU finished programming the Flash */
-        while (((SPMCR->bits).SPMEN) != EEPROM_WRITE_CONDITION)
-            ;
-#endif
+        /* Set EEPROM status to NULL Pointer */
+        EEPROM_status = PTR_USED_IS_NULL_PTR;
     }
-#elif OS == TIME_TRIGGER_OS
-    /* Check if EEPROM is ready to be written */
-    if (
-        ((((EEPROM->EECR).bits).EEWE) == EEPROM_DATA_REG_IS_AVAILABLE)
-#if BOOT_LOADER_USAGE == BOOT_LOADER_IS_USED
-        /* Check if CPU finished programming the Flash */
-        && (((SPMCR->bits).SPMEN) == EEPROM_WRITE_CONDITION)
-#endif
-    )
-    {
-#endif
-    /* Disable Interrupts */
-    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
-
-    /* Check if the address in available EEPROM Space */
-    if (address <= EEPROM_LAST_LOCATION)
+    /* Check if all data is in the cache window */
+    else if (((uint16_t)(address - EEPROM_CACHE_BASE_ADDRESS) >= EEPROM_CACHE_SIZE) ||
+             (length > (uint16_t)(EEPROM_CACHE_LAST_ADDRESS - address + 1U)))
     {
-        /* Set the EEPROM Address at which data will be written */
-        ((EEPROM->EEARL).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_LEAST_BYTE));
-        ((EEPROM->EEARH).reg) = ((uint8_t)(address >> EEPROM_ADDRESS_MOST_BYTE));
-
-        /* Set the EEPROM Data */
-        ((EEPROM->EEDR).reg) = byte;
-
-        /* Set EEPROM Master Write Enable */
-        (((EEPROM->EECR).bits).EEMWE) = SET_VALUE;
-
-        /* Set EEPROM Write Enable */
-        ((EEPROM->EECR).reg) = EEPROM_WRITE_ENABLE_CONDITION;
-
-        /* Enable Interrupts */
-        ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
-
-        /* Data is written */
-        EEPROM_status = EEPROM_DATA_IS_WRITTEN;
+        /* Data must be read by EEPROM_read_data */
+        EEPROM_status = EEPROM_ADDRESS_IS_NOT_CACHED;
     }
     else
     {
-        /* Update Driver Error value */
-        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+        /* Copy data from RAM */
+        for (index = 0U; index < length; index++)
+        {
+            data[index] = EEPROM_cache[(address - EEPROM_CACHE_BASE_ADDRESS) + index];
+        }
+
+        /* Data is read */
+        EEPROM_status = EEPROM_DATA_IS_READ;
     }
-#if OS == TIME_TRIGGER_OS
-}
-#endif
 
-/* Return EEPROM status */
-return EEPROM_status;
+    /* Return EEPROM status */
+    return EEPROM_status;
 }
 
 /**
- * @brief This API is used to write more than byte of data in successive addresses in EEPROM.
- * @param base_address The start Address at which data will be written.
- * @param data A pointer to data that will be written in the given addresses in EEPROM.
- * @param length The length of data that wanted to be written in EEPROM.
- * @param actual_length A pointer to length of data that has been actually written in EEPROM.
- * @return The Actual length of data that has been written in EEPROM and
- * the status of EEPROM (EEPROM_DATA_IS_WRITTEN, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ * @brief This API is used to write successive bytes of the cache window in RAM and mark the changed bytes as dirty.
+ * @param address The start Address of data in EEPROM.
+ * @param data A pointer to the data.
+ * @param length The length of data.
+ * @note Data is persisted by EEPROM_flush or EEPROM_cache_drain, and it is lost if it is not written back before reset.
+ * @note The cache window must not be written by the other EEPROM write APIs, otherwise the cache is not coherent.
+ * @return The status of EEPROM (EEPROM_DATA_IS_QUEUED, EEPROM_ADDRESS_IS_NOT_CACHED or PTR_USED_IS_NULL_PTR).
  */
-driver_status_t EEPROM_write_data(uint16_t base_address, uint8_t *data, uint16_t length, uint16_t *actual_length)
+driver_status_t EEPROM_cache_write(uint16_t address, uint8_t *data, uint16_t length)
 {
     driver_status_t EEPROM_status = DRIVER_IS_OK;
-    static uint16_t next_location = EEPROM_NO_ADDRESS;
+    uint16_t index = 0U;
 
-    /* Check if the pointers are null pointers */
-    if ((data == NULL_PTR) || (actual_length == NULL_PTR))
+    /* Check if the pointer is null pointer */
+    if (data == NULL_PTR)
     {
         /* Set EEPROM status to NULL Pointer */
         EEPROM_status = PTR_USED_IS_NULL_PTR;
     }
+    /* Check if all data is in the cache window */
+    else if (((uint16_t)(address - EEPROM_CACHE_BASE_ADDRESS) >= EEPROM_CACHE_SIZE) ||
+             (length > (uint16_t)(EEPROM_CACHE_LAST_ADDRESS - address + 1U)))
+    {
+        /* Data must be written by EEPROM_write_data */
+        EEPROM_status = EEPROM_ADDRESS_IS_NOT_CACHED;
+    }
     else
     {
-        /* Check if the Base Address is available or not */
-        if (base_address <= EEPROM_LAST_LOCATION)
+        /* Convert the address to cache index */
+        address = (uint16_t)(address - EEPROM_CACHE_BASE_ADDRESS);
+
+        for (index = 0U; index < length; index++)
         {
-/* Check which OS is used */
-#if OS == SUPER_LOOP_OS
-            while
-#elif OS == TIME_TRIGGER_OS
-                if
-#endif
-                /* Check if there is still data need to be written */
-                ((*actual_length < length) && (next_location <= EEPROM_LAST_LOCATION))
+            /* Check if the byte is changed */
+            if (EEPROM_cache[address] != data[index])
+            {
+                /* Update the byte and mark it as dirty */
+                EEPROM_cache[address] = data[index];
+                EEPROM_cache_dirty[EEPROM_CACHE_BITMAP_BYTE(address)] |= EEPROM_CACHE_BITMAP_BIT(address);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            address++;
+        }
+
+        /* Data waits to be written back */
+        EEPROM_status = EEPROM_DATA_IS_QUEUED;
+    }
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to write back dirty bytes of the cache window without waiting.
+ * @note Each dirty byte is compared with EEPROM first (read with EEPROM Ready Interrupt masked), so only bytes which
+ * really differ are programmed.
+ * @note It returns as soon as one byte is programmed or a writing process is going on, so it can be called periodically
+ * as a background task.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN if there is no dirty byte, otherwise EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+driver_status_t EEPROM_cache_drain(void)
+{
+    driver_status_t EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+    uint16_t checked = 0U;
+    uint16_t address = 0U;
+    uint8_t is_busy = CLEAR_VALUE;
+    uint8_t stored = CLEAR_VALUE;
+
+    /* Check the bytes once starting from the cursor until one byte is programmed */
+    while ((checked < EEPROM_CACHE_SIZE) && (is_busy == CLEAR_VALUE))
+    {
+        /* Skip 8 clean bytes at once */
+        if (((EEPROM_cache_cursor & 7U) == 0U) &&
+            (EEPROM_cache_dirty[EEPROM_CACHE_BITMAP_BYTE(EEPROM_cache_cursor)] == EEPROM_CACHE_IS_CLEAN))
+        {
+            checked = (uint16_t)(checked + 8U);
+            EEPROM_cache_cursor = (uint16_t)(EEPROM_cache_cursor + 8U);
+        }
+        /* Check if the byte is dirty */
+        else if ((EEPROM_cache_dirty[EEPROM_CACHE_BITMAP_BYTE(EEPROM_cache_cursor)] &
+                  EEPROM_CACHE_BITMAP_BIT(EEPROM_cache_cursor)) != EEPROM_CACHE_IS_CLEAN)
+        {
+            address = (uint16_t)(EEPROM_CACHE_BASE_ADDRESS + EEPROM_cache_cursor);
+
+            /* Read the byte with EEPROM Ready Interrupt masked (nothing is read if there is a writing process going on) */
+            if (EEPROM_read_block(address, &stored, 1U) == EEPROM_NO_DATA)
+            {
+                /* Continue in the next call */
+                is_busy = SET_VALUE;
+            }
+            else
             {
-                /* Check if that is a new data block */
-                if (*actual_length == EEPROM_NO_DATA)
+                /* Program the byte only if EEPROM holds a different value (only one byte is programmed per call) */
+                if (stored != EEPROM_cache[EEPROM_cache_cursor])
                 {
-                    /* Set next location by base address */
-                    next_location = base_address;
+                    is_busy = SET_VALUE;
+                    EEPROM_status = EEPROM_write_byte(address, EEPROM_cache[EEPROM_cache_cursor]);
                 }
                 else
                 {
-                    /* Do Nothing */
+                    EEPROM_status = EEPROM_DATA_IS_WRITTEN;
                 }
-                /* Write data of the given index */
-                EEPROM_status = EEPROM_write_byte(next_location, data[*actual_length]);
 
-                /* Check if the Data is written or not */
+                /* Mark the byte as clean if it is programmed or it is not changed, otherwise retry in the next call */
                 if (EEPROM_status == EEPROM_DATA_IS_WRITTEN)
                 {
-                    /* Update next Location */
-                    next_location++;
-                    /* Update the actual length */
-                    (*actual_length)++;
+                    EEPROM_cache_dirty[EEPROM_CACHE_BITMAP_BYTE(EEPROM_cache_cursor)] &= (uint8_t)(~EEPROM_CACHE_BITMAP_BIT(EEPROM_cache_cursor));
+                    checked++;
+                    EEPROM_cache_cursor++;
                 }
                 else
                 {
                     /* Do Nothing */
                 }
             }
-#if OS == TIME_TRIGGER_OS
-            else
-#endif
-                if (*actual_length >= length)
-            {
-                /* All Data has been written */
-                EEPROM_status = EEPROM_DATA_IS_WRITTEN;
-            }
-            else
-            {
-                /* Not All Data has been written */
-                EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
-            }
         }
         else
         {
-            /* EEPROM Base Address is not available */
-            EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+            checked++;
+            EEPROM_cache_cursor++;
+        }
+
+        /* Wrap the cursor */
+        if (EEPROM_cache_cursor >= EEPROM_CACHE_SIZE)
+        {
+            EEPROM_cache_cursor = 0U;
+        }
+        else
+        {
+            /* Do Nothing */
         }
     }
 
+    /* All bytes are clean if they have been checked without programming any byte */
+    EEPROM_status = (is_busy == CLEAR_VALUE) ? EEPROM_DATA_IS_WRITTEN : EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+
     /* Return EEPROM status */
     return EEPROM_status;
 }
 
 /**
- * @brief This API is used to read 1 byte or more successive bytes from EEPROM.
- * @param base_address The start Address from which data will be read.
- * @param data A pointer to data that will be read from the given addresses in EEPROM.
- * @param length The length of data that wanted to be read from EEPROM.
- * @param actual_length A pointer to length of data that has been actually read from EEPROM.
- * @return The Actual length of data that has been read in EEPROM and
- * the status of EEPROM (EEPROM_DATA_IS_READ, EEPROM_ADDRESS_NOT_AVAILABLE, EEPROM_DATA_IS_NOT_COMPLETELY_READ or PTR_USED_IS_NULL_PTR).
+ * @brief This API is used to write back all dirty bytes of the cache window.
+ * @note In SUPER_LOOP_OS, it waits until all dirty bytes are written back.
+ * @note In TIME_TRIGGER_OS, it is the same as EEPROM_cache_drain and must be called until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN or EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
  */
-driver_status_t EEPROM_read_data(uint16_t base_address, uint8_t *data, uint16_t length, uint16_t *actual_length)
+driver_status_t EEPROM_flush(void)
 {
     driver_status_t EEPROM_status = DRIVER_IS_OK;
-    static uint16_t next_location = EEPROM_NO_ADDRESS;
 
-    /* Check if the pointers are null Pointers */
-    if ((data == NULL_PTR) || (actual_length == NULL_PTR))
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+    do
+    {
+        /* Wait until there is no writing process going on */
+        EEPROM_wait_ready();
+
+        /* Write back the next dirty byte */
+        EEPROM_status = EEPROM_cache_drain();
+    } while (EEPROM_status != EEPROM_DATA_IS_WRITTEN);
+#elif OS == TIME_TRIGGER_OS
+    /* Write back the next dirty byte */
+    EEPROM_status = EEPROM_cache_drain();
+#endif
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+#endif
+
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+/**
+ * @brief This API is used to write successive bytes through the pending stage, the writes to the same addresses are
+ * merged in RAM until their hold-off is elapsed.
+ * @param base_address The start Address at which data will be written.
+ * @param data A pointer to the data.
+ * @param length The length of data.
+ * @note The hold-off of an address starts at its first pending write and is not restarted by the next writes, so a value
+ * which is updated continuously is still committed every EEPROM_COALESCE_HOLD_OFF calls of EEPROM_process_pending.
+ * @note EEPROM_read_data returns the pending bytes, but the other EEPROM write APIs must not write the pending addresses.
+ * @return The status of EEPROM (EEPROM_DATA_IS_QUEUED, EEPROM_QUEUE_IS_FULL if there are not enough free entries for the new
+ * addresses (nothing is written), EEPROM_ADDRESS_NOT_AVAILABLE or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t EEPROM_write_pending(uint16_t base_address, uint8_t *data, uint16_t length)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint16_t index = 0U;
+    uint16_t new_entries = 0U;
+    uint8_t entry = 0U;
+
+    /* Check if the pointer is null pointer */
+    if (data == NULL_PTR)
     {
         /* Set EEPROM status to NULL Pointer */
         EEPROM_status = PTR_USED_IS_NULL_PTR;
     }
+    /* Check if all data is in available EEPROM Space */
+    else if ((base_address > EEPROM_LAST_LOCATION) || (length > (uint16_t)(EEPROM_LAST_LOCATION - base_address + 1U)))
+    {
+        /* EEPROM Base Address is not available */
+        EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
     else
     {
-        /* Check if the Base Address is available or not */
-        if (base_address <= EEPROM_LAST_LOCATION)
+        /* Count the addresses which are not pending */
+        for (index = 0U; index < length; index++)
         {
-/* Check which OS is used */
-#if OS == SUPER_LOOP_OS
-            while
-#elif OS == TIME_TRIGGER_OS
-            if
-#endif
-                /* Check if there is still data need to be read and
-                there is still locations available in EEPROM */
-                ((*actual_length < length) && (next_location <= EEPROM_LAST_LOCATION))
+            if (EEPROM_find_pending((uint16_t)(base_address + index)) == EEPROM_pending_count)
+            {
+                new_entries++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        /* Check if there are enough free entries */
+        if (new_entries > (uint16_t)(EEPROM_COALESCE_SIZE - EEPROM_pending_count))
+        {
+            EEPROM_status = EEPROM_QUEUE_IS_FULL;
+        }
+        else
+        {
+            for (index = 0U; index < length; index++)
             {
-                /* Check if that is a new data block */
-                if (*actual_length == EEPROM_NO_DATA)
+                entry = EEPROM_find_pending((uint16_t)(base_address + index));
+
+                /* Check if that is a new address */
+                if (entry == EEPROM_pending_count)
                 {
-                    /* Set next location by base address */
-                    next_location = base_address;
+                    EEPROM_pending[entry].address = (uint16_t)(base_address + index);
+                    EEPROM_pending[entry].age = EEPROM_PENDING_NEW_AGE;
+                    EEPROM_pending_count++;
                 }
                 else
                 {
                     /* Do Nothing */
                 }
 
-                /* Make sure that there is no wirting process is going on */
-#if OS == SUPER_LOOP_OS
-                while (((((EEPROM->EECR).bits).EEWE) != EEPROM_DATA_REG_IS_AVAILABLE))
-                    ;
-#elif OS == TIME_TRIGGER_OS
-                if (((((EEPROM->EECR).bits).EEWE) == EEPROM_DATA_REG_IS_AVAILABLE))
-                {
-#endif
-                /* Set the Address from which data will be read */
-                ((EEPROM->EEARL).reg) = ((uint8_t)(next_location >> EEPROM_ADDRESS_LEAST_BYTE));
-                ((EEPROM->EEARH).reg) = ((uint8_t)(next_location >> EEPROM_ADDRESS_MOST_BYTE));
+                /* Merge the byte with the previous pending write */
+                EEPROM_pending[entry].byte = data[index];
+            }
 
-                /* Enable EEPROM Read */
-                (((EEPROM->EECR).bits).EERE) = SET_VALUE;
+            /* Data waits to be committed */
+            EEPROM_status = EEPROM_DATA_IS_QUEUED;
+        }
+    }
 
-                /* Store the data */
-                data[*actual_length] = ((EEPROM->EEDR).reg);
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
 
-                /* Update next Location */
-                next_location++;
+/**
+ * @brief This API is used to age the pending bytes and commit the bytes whose hold-off is elapsed without waiting.
+ * @note It must be called periodically (e.g. as a scheduler task), the hold-off is counted in calls of that API.
+ * @note At most one byte is programmed per call.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN if no pending byte is left, otherwise
+ * EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+driver_status_t EEPROM_process_pending(void)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+    uint8_t entry = 0U;
 
-                /* Update the actual length */
-                (*actual_length)++;
-#if OS == TIME_TRIGGER_OS
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
-#endif
-            }
-#if OS == TIME_TRIGGER_OS
-            else
-#endif
-            if (*actual_length >= length)
-            {
-                /* All Data has been read */
-                EEPROM_status = EEPROM_DATA_IS_READ;
-            }
-            else
-            {
-                /* Not All Data has been read */
-                EEPROM_status = EEPROM_DATA_IS_NOT_COMPLETELY_READ;
-            }
+    /* Age the pending bytes */
+    for (entry = 0U; entry < EEPROM_pending_count; entry++)
+    {
+        if (EEPROM_pending[entry].age < EEPROM_COALESCE_HOLD_OFF)
+        {
+            EEPROM_pending[entry].age++;
         }
         else
         {
-            /* EEPROM Base Address is not available */
-            EEPROM_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+            /* Do Nothing */
         }
     }
 
+    /* Commit the bytes whose hold-off is elapsed */
+    EEPROM_status = EEPROM_commit_pending(EEPROM_COALESCE_HOLD_OFF);
+
+    /* Return EEPROM status */
+    return EEPROM_status;
+}
+
+/**
+ * @brief This API is used to commit all pending bytes without waiting for their hold-off (e.g. before shutdown).
+ * @note In SUPER_LOOP_OS, it waits until all pending bytes are committed.
+ * @note In TIME_TRIGGER_OS, at most one byte is programmed per call, so it must be called until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN or EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+driver_status_t EEPROM_flush_pending(void)
+{
+    driver_status_t EEPROM_status = DRIVER_IS_OK;
+
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+    do
+    {
+        /* Wait until there is no writing process going on */
+        EEPROM_wait_ready();
+
+        /* Commit the next pending byte */
+        EEPROM_status = EEPROM_commit_pending(EEPROM_PENDING_ANY_AGE);
+    } while (EEPROM_status != EEPROM_DATA_IS_WRITTEN);
+#elif OS == TIME_TRIGGER_OS
+    /* Commit the next pending byte */
+    EEPROM_status = EEPROM_commit_pending(EEPROM_PENDING_ANY_AGE);
+#endif
+
     /* Return EEPROM status */
     return EEPROM_status;
 }
+#endif
 
 /**
  * @brief This API is used to Enable EEPROM Interrupt.
+ * @note In IRQ_LATENCY_TRACKING build, it closes the window which has been opened by IRQ_LATENCY_START after the caller
+ * disabled Global Interrupt.
  */
 void EEPROM_enable_interrupt(void)
 {
     /* Enable Global Interrupt */
+    IRQ_LATENCY_STOP(ILT_EEPROM_ENABLE_INTERRUPT);
     ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
 
     /* Enable EEPROM Interrupt */
@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 12:10:32                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 12:10:32                              *
+ * @FilePath              : GPIO_fast.h                                      *
+ ****************************************************************************/
+
+#ifndef GPIO_GPIO_FAST_H_
+#define GPIO_GPIO_FAST_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "GPIO_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Inline APIs are always inlined so that constant arguments are seen by the compiler.
+ */
+#define GPIO_FAST_API               static inline __attribute__((always_inline))
+
+/**
+ * @brief Get the registers of the given Port without the Ports table.
+ * @note It is folded to a constant address when the port is a compile-time constant.
+ */
+#define GPIO_FAST_REGS(port)        IO_ACCESS(((port) == PORT_A) ? GPIO_A_REGS : \
+                                              ((port) == PORT_B) ? GPIO_B_REGS : \
+                                              ((port) == PORT_C) ? GPIO_C_REGS : GPIO_D_REGS)
+
+/**
+ * @brief Check if the arguments are compile-time constants and valid.
+ */
+#define GPIO_FAST_IS_CONSTANT(port, pin)                                                    \
+    (__builtin_constant_p(port) && __builtin_constant_p(pin) && ((port) < PORT_MAX) &&      \
+     ((pin) <= PIN_ALL) && ((pin) != 0U))
+
+#define GPIO_FAST_IS_SINGLE_PIN(pin)    ((((pin) & ((pin) - 1U))) == 0U)
+
+
+/**
+ * @section APIs
+ */
+
+/**
+ * @brief This API is the inline version of GPIO_set_pin_level.
+ * @note If port, pin and level are compile-time constants, it is compiled to one SBI or CBI instruction for a single pin
+ * (or one read-modify-write for more pins), otherwise GPIO_set_pin_level is called.
+ * @example GPIO_set_pin_level_fast(PORT_B, PIN_3, PIN_HIGH_LEVEL).
+ * @return The status of the API (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+GPIO_FAST_API driver_status_t GPIO_set_pin_level_fast(gpio_port_t port, gpio_pin_t pin, gpio_level_t level)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+
+    if (GPIO_FAST_IS_CONSTANT(port, pin) && __builtin_constant_p(level) && (level == PIN_HIGH_LEVEL))
+    {
+        /* Set Pin Level */
+        ((GPIO_FAST_REGS(port)->PORT).reg) |= (uint8_t)pin;
+    }
+    else if (GPIO_FAST_IS_CONSTANT(port, pin) && __builtin_constant_p(level) && (level == PIN_LOW_LEVEL))
+    {
+        /* Clear Pin Level */
+        ((GPIO_FAST_REGS(port)->PORT).reg) &= (uint8_t)(~pin);
+    }
+    else
+    {
+        /* Use the checked path */
+        GPIO_status = GPIO_set_pin_level(port, pin, level);
+    }
+
+    return GPIO_status;
+}
+
+/**
+ * @brief This API is the inline version of GPIO_get_pin_level.
+ * @note If port and pin are compile-time constants and pin is a single pin, it is compiled to one SBIS or SBIC instruction
+ * (or one IN instruction), otherwise GPIO_get_pin_level is called.
+ * @example GPIO_get_pin_level_fast(PORT_A, PIN_0, &level).
+ * @return The level of the Pin and the status of the API (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or VALUE_IS_NOT_EXISTED).
+ */
+GPIO_FAST_API driver_status_t GPIO_get_pin_level_fast(gpio_port_t port, gpio_pin_t pin, gpio_level_t * level)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+
+    if (GPIO_FAST_IS_CONSTANT(port, pin) && GPIO_FAST_IS_SINGLE_PIN(pin) && (level != NULL_PTR))
+    {
+        /* Get the Pin level */
+        *level = ((((GPIO_FAST_REGS(port)->PIN).reg) & (uint8_t)pin) != 0U) ? PIN_HIGH_LEVEL : PIN_LOW_LEVEL;
+    }
+    else
+    {
+        /* Use the checked path */
+        GPIO_status = GPIO_get_pin_level(port, pin, level);
+    }
+
+    return GPIO_status;
+}
+
+/**
+ * @brief This API is the inline version of GPIO_tog_pin_level.
+ * @note If port and pin are compile-time constants, it is compiled to IN, EOR and OUT instructions without the checks,
+ * otherwise GPIO_tog_pin_level is called (Atmega32 can not toggle a pin by writing its PIN register).
+ * @example GPIO_tog_pin_level_fast(PORT_C, PIN_7).
+ * @return The status of the API (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+GPIO_FAST_API driver_status_t GPIO_tog_pin_level_fast(gpio_port_t port, gpio_pin_t pin)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+
+    if (GPIO_FAST_IS_CONSTANT(port, pin))
+    {
+        /* Toggle Pin level */
+        ((GPIO_FAST_REGS(port)->PORT).reg) ^= (uint8_t)pin;
+    }
+    else
+    {
+        /* Use the checked path */
+        GPIO_status = GPIO_tog_pin_level(port, pin);
+    }
+
+    return GPIO_status;
+}
+
+#endif
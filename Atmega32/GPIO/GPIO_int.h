@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-08-28 11:52:17                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2023-08-30 17:27:04                              *
+ * @LastEditDate          : 2026-10-18 01:09:00                              *
  * @FilePath              : GPIO_int.h                                       *
  ****************************************************************************/
 
@@ -73,14 +73,33 @@ typedef enum
     PIN_MAX_MODE
 }gpio_mode_t;
 
+/**
+ * @brief GPIO Pin Configuration (one entry of the pins configuration table of GPIO_init)
+ * @note The fields are bytes holding the enums values, so each one is read from flash by one FLASH_READ_BYTE
+ * whatever the size of the enums.
+ * @example static const gpio_config_t board_pins[] FLASH_CONST = {{PORT_B, PIN_3, PIN_OUTPUT, PIN_HIGH_LEVEL}, ...}.
+ */
+
+typedef struct
+{
+    uint8_t port;               /* Port of the pins (gpio_port_t)                                 */
+    uint8_t pin;                /* Pin or Pins (gpio_pin_t, PIN_0 | PIN_1 | ...)                  */
+    uint8_t mode;               /* Mode of the pins (gpio_mode_t)                                 */
+    uint8_t level;              /* Initial level of output pins (gpio_level_t, ignored by inputs) */
+}gpio_config_t;
+
 
 /**
  * @section APIs
  */
 
+driver_status_t GPIO_init         (const gpio_config_t *, uint8_t);
 driver_status_t GPIO_set_pin_mode (gpio_port_t, gpio_pin_t, gpio_mode_t);
 driver_status_t GPIO_set_pin_level(gpio_port_t, gpio_pin_t, gpio_level_t);
 driver_status_t GPIO_get_pin_level(gpio_port_t, gpio_pin_t, gpio_level_t *);
 driver_status_t GPIO_tog_pin_level(gpio_port_t, gpio_pin_t);
+driver_status_t GPIO_write_port_masked(gpio_port_t, uint8_t, uint8_t);
+driver_status_t GPIO_read_port    (gpio_port_t, uint8_t *);
+driver_status_t GPIO_read_all_ports(uint8_t *);
 
 #endif
\ No newline at end of file
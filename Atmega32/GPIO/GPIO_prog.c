@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-08-28 11:54:20                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2024-01-11 09:41:44                              *
+ * @LastEditDate          : 2026-10-18 01:09:00                              *
  * @FilePath              : GPIO_prog.c                                      *
  ****************************************************************************/
 
@@ -19,22 +19,173 @@
  */
 
 /**
- * @brief GPIO Ports Array contains registers of Atmega32 ports.
+ * @brief GPIO Ports Array contains registers base addresses of Atmega32 ports (placed in flash).
  */
 
-static GPIO_Reg_S * GPIO_PORTS[PORT_MAX] =
+static const uint8_t GPIO_PORTS[PORT_MAX] FLASH_CONST =
 {
-    GPIO_A_REGS,
-    GPIO_B_REGS,
-    GPIO_C_REGS,
-    GPIO_D_REGS
+    GPIO_A_BASE_ADDRESS,
+    GPIO_B_BASE_ADDRESS,
+    GPIO_C_BASE_ADDRESS,
+    GPIO_D_BASE_ADDRESS
 };
 
 
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Get the registers base address of the given Port from the Ports table (one flash read).
+ * @note The APIs keep it in a local pointer and access the registers through IO_ACCESS.
+ */
+#define GPIO_PORT_BASE(port)    ((GPIO_Reg_S *) IO_ADDRESS((uintptr_t)FLASH_READ_BYTE(&GPIO_PORTS[(port)])))
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to read one entry of a pins configuration table from flash.
+ * @param config The address of the entry in flash.
+ * @param entry A pointer to the read entry.
+ * @note Each field is one byte, so it is read by one flash read.
+ */
+static void GPIO_read_config(const gpio_config_t * config, gpio_config_t * entry)
+{
+    entry->port = FLASH_READ_BYTE(&(config->port));
+    entry->pin = FLASH_READ_BYTE(&(config->pin));
+    entry->mode = FLASH_READ_BYTE(&(config->mode));
+    entry->level = FLASH_READ_BYTE(&(config->level));
+}
+
+
 /**
  * @section APIs Implementation 
  */
 
+/**
+ * @brief This API is used to configure the pins of a board from a pins configuration table at startup.
+ * @param table The pins configuration table (declared with FLASH_CONST), a later entry overrides the earlier entries of the same pins.
+ * @param length The number of entries of the table.
+ * @note The whole table is folded into DDR and PORT values per port before any register is written, then each configured
+ * port is written once: PORT first so that the output pins drive their initial level as soon as DDR is written.
+ * @note Pins which are not in the table keep their mode and level, and nothing is written if an entry is not valid.
+ * @example GPIO_init(board_pins, sizeof(board_pins) / sizeof(board_pins[0])).
+ * @return The status of the API (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t GPIO_init(const gpio_config_t * table, uint8_t length)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+    uint8_t masks[PORT_MAX] = {CLEAR_VALUE};
+    uint8_t ddr_values[PORT_MAX] = {CLEAR_VALUE};
+    uint8_t port_values[PORT_MAX] = {CLEAR_VALUE};
+    uint8_t is_pull_up_used = CLEAR_VALUE;
+    uint8_t index = 0U;
+    gpio_config_t entry;
+    GPIO_Reg_S * port_regs = NULL_PTR;
+
+    /* Check if the Pointer is NULL pointer */
+    if(table != NULL_PTR)
+    {
+        /* Fold the table into the values of each port */
+        for(index = 0U; (index < length) && (GPIO_status == DRIVER_IS_OK); index++)
+        {
+            GPIO_read_config(&table[index], &entry);
+
+            /* Check if the Port existed or not */
+            if(entry.port < PORT_MAX)
+            {
+                masks[entry.port] |= (uint8_t)entry.pin;
+
+                switch (entry.mode)
+                {
+                case PIN_OUTPUT:
+                    /* Set Pin Direction to Output with its initial level */
+                    ddr_values[entry.port] |= (uint8_t)entry.pin;
+                    if(entry.level == PIN_HIGH_LEVEL)
+                    {
+                        port_values[entry.port] |= (uint8_t)entry.pin;
+                    }
+                    else if(entry.level == PIN_LOW_LEVEL)
+                    {
+                        port_values[entry.port] &= (uint8_t)(~entry.pin);
+                    }
+                    else
+                    {
+                        /* Level value is not existed */
+                        GPIO_status = VALUE_IS_NOT_EXISTED;
+                    }
+                    break;
+                case PIN_FLOATING_INPUT:
+                    /* Set Pin Direction to Input without Pull-up */
+                    ddr_values[entry.port] &= (uint8_t)(~entry.pin);
+                    port_values[entry.port] &= (uint8_t)(~entry.pin);
+                    break;
+                case PIN_PULL_UP_INPUT:
+                    /* Set Pin Direction to Input with Pull-up */
+                    ddr_values[entry.port] &= (uint8_t)(~entry.pin);
+                    port_values[entry.port] |= (uint8_t)entry.pin;
+                    is_pull_up_used = SET_VALUE;
+                    break;
+                default:
+                    /* Mode value is not existed */
+                    GPIO_status = VALUE_IS_NOT_EXISTED;
+                    break;
+                }
+            }
+            else
+            {
+                /* Port value is not existed */
+                GPIO_status = VALUE_IS_NOT_EXISTED;
+            }
+        }
+
+        /* Write the registers only if the whole table is valid */
+        if(GPIO_status == DRIVER_IS_OK)
+        {
+            if(is_pull_up_used == SET_VALUE)
+            {
+                /* Enable Pull-up for all Ports */
+                ((SFIOR->bits).PUD) = CLEAR_VALUE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            for(index = 0U; index < PORT_MAX; index++)
+            {
+                /* Check if the port is configured */
+                if(masks[index] != CLEAR_VALUE)
+                {
+                    /* Get the registers of the Port once */
+                    port_regs = GPIO_PORT_BASE(index);
+                    ((IO_ACCESS(port_regs)->PORT).reg) = (uint8_t)((((IO_ACCESS(port_regs)->PORT).reg) & (uint8_t)(~masks[index])) | port_values[index]);
+                    ((IO_ACCESS(port_regs)->DDR).reg) = (uint8_t)((((IO_ACCESS(port_regs)->DDR).reg) & (uint8_t)(~masks[index])) | ddr_values[index]);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* The pointer is Null Pointer */
+        GPIO_status = PTR_USED_IS_NULL_PTR;
+    }
+
+    /* Return API status */
+    return GPIO_status;
+}
+
 /**
  * @brief This API is used to set mode for one or more pins of same port.
  * @param port The Port whose pin or pins mode will be set (PORT_A -> PORT_D).
@@ -48,6 +199,7 @@ static GPIO_Reg_S * GPIO_PORTS[PORT_MAX] =
 driver_status_t GPIO_set_pin_mode (gpio_port_t port, gpio_pin_t pin, gpio_mode_t mode)
 {
     driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
 
     /* check if Port existed or not */
     if(port < PORT_MAX)
@@ -55,26 +207,29 @@ driver_status_t GPIO_set_pin_mode (gpio_port_t port, gpio_pin_t pin, gpio_mode_t
         /* check if Pin existed or not */
         if(pin <= PIN_ALL)
         {
+            /* Get the registers of the Port once */
+            port_regs = GPIO_PORT_BASE(port);
+
             /* Set Pin(s) Mode */
             switch (mode)
             {
             case PIN_FLOATING_INPUT:
                 /* Disable Pull-up for Pin */
-                ((GPIO_PORTS[port]->PORT).reg) &= ~pin;
+                ((IO_ACCESS(port_regs)->PORT).reg) &= ~pin;
                 /* Set Pin Direction to Input */
-                ((GPIO_PORTS[port]->DDR).reg) &= ~pin;
+                ((IO_ACCESS(port_regs)->DDR).reg) &= ~pin;
                 break;
             case PIN_PULL_UP_INPUT:
                 /* Enable Pull-up for all Ports */
                 ((SFIOR->bits).PUD) = CLEAR_VALUE;
                 /* Enable Pull-up for Pin */
-                ((GPIO_PORTS[port]->PORT).reg) |= pin;
+                ((IO_ACCESS(port_regs)->PORT).reg) |= pin;
                 /* Set Pin Direction to Input*/
-                ((GPIO_PORTS[port]->DDR).reg) &= ~pin;
+                ((IO_ACCESS(port_regs)->DDR).reg) &= ~pin;
                 break;
             case PIN_OUTPUT:
                 /* Set Pin Direction to Output */
-                ((GPIO_PORTS[port]->DDR).reg) |= pin;
+                ((IO_ACCESS(port_regs)->DDR).reg) |= pin;
                 break;
             default:
                 /* Mode value is not existed */
@@ -111,6 +266,7 @@ driver_status_t GPIO_set_pin_mode (gpio_port_t port, gpio_pin_t pin, gpio_mode_t
 driver_status_t GPIO_set_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_t level)
 {
     driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
 
     /* check if Port existed or not */
     if(port < PORT_MAX)
@@ -118,16 +274,19 @@ driver_status_t GPIO_set_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_
         /* check if Pin existed or not */
         if(pin <= PIN_ALL)
         {
+            /* Get the registers of the Port once */
+            port_regs = GPIO_PORT_BASE(port);
+
             /* Set Pin(s) Mode */
             switch (level)
             {
             case PIN_LOW_LEVEL:
                 /* Set Pin level */
-                ((GPIO_PORTS[port]->PORT).reg) &= ~pin;
+                ((IO_ACCESS(port_regs)->PORT).reg) &= ~pin;
                 break;
             case PIN_HIGH_LEVEL:
                 /* Set Pin Level */
-                ((GPIO_PORTS[port]->PORT).reg) |= pin;           
+                ((IO_ACCESS(port_regs)->PORT).reg) |= pin;           
                 break;
             default:
                 /* Level value is not existed */
@@ -162,6 +321,7 @@ driver_status_t GPIO_set_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_
 driver_status_t GPIO_get_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_t * level)
 {
     driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
 
     /* Check if the Pointer is NULL pointer */
     if(level != NULL_PTR)
@@ -173,8 +333,9 @@ driver_status_t GPIO_get_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_
             if(pin == PIN_0 || pin == PIN_1 || pin == PIN_2 || pin == PIN_3 
             || pin == PIN_4 || pin == PIN_5 || pin == PIN_6 || pin == PIN_7)
             {
-                /* Get the Pin level */
-                *level = (((GPIO_PORTS[port]->PIN).reg) & pin);
+                /* Get the registers of the Port once, then the Pin level */
+                port_regs = GPIO_PORT_BASE(port);
+                *level = (((IO_ACCESS(port_regs)->PIN).reg) & pin);
                 /* Set level to level values */
                 if(*level != PIN_LOW_LEVEL)
                 {
@@ -220,14 +381,16 @@ driver_status_t GPIO_get_pin_level(gpio_port_t port, gpio_pin_t pin, gpio_level_
 driver_status_t GPIO_tog_pin_level(gpio_port_t port, gpio_pin_t pin)
 {
     driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
 
     /* Check if the port existed or not */
     if(port < PORT_MAX)
     {
         if(pin <= PIN_ALL)
         {
-            /* Toggle Pin level */
-            ((GPIO_PORTS[port]->PORT).reg) ^= pin;
+            /* Get the registers of the Port once, then toggle Pin level */
+            port_regs = GPIO_PORT_BASE(port);
+            ((IO_ACCESS(port_regs)->PORT).reg) ^= pin;
         }
         else
         {
@@ -244,3 +407,100 @@ driver_status_t GPIO_tog_pin_level(gpio_port_t port, gpio_pin_t pin)
     /* Return API status */
     return GPIO_status;
 }
+
+/**
+ * @brief This API is used to write the levels of many pins of same port in one read-modify-write.
+ * @param port The Port whose pins levels will be written (PORT_A -> PORT_D).
+ * @param mask The pins whose levels will be written (bit per pin, PIN_0 | PIN_1 | ...| PIN_7 or PIN_ALL).
+ * @param value The levels of the pins (bit per pin), bits out of the mask are ignored.
+ * @example GPIO_write_port_masked(PORT_C, 0xF0, data << 4) to write the high nibble of PORT_C.
+ * @return The status of the API (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t GPIO_write_port_masked(gpio_port_t port, uint8_t mask, uint8_t value)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
+
+    /* Check if the port existed or not */
+    if(port < PORT_MAX)
+    {
+        /* Get the registers of the Port once, then write Pins levels */
+        port_regs = GPIO_PORT_BASE(port);
+        ((IO_ACCESS(port_regs)->PORT).reg) = (uint8_t)((((IO_ACCESS(port_regs)->PORT).reg) & (uint8_t)(~mask)) | (value & mask));
+    }
+    else
+    {
+        /* The Port value is not existed */
+        GPIO_status = VALUE_IS_NOT_EXISTED;
+    }
+
+    /* Return API status */
+    return GPIO_status;
+}
+
+/**
+ * @brief This API is used to read the levels of all pins of a port.
+ * @param port The Port whose pins levels will be read (PORT_A -> PORT_D).
+ * @param value A pointer to the levels of the pins (bit per pin).
+ * @example GPIO_read_port(PORT_A, &value).
+ * @return The levels of the Port pins and the status of the API (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t GPIO_read_port(gpio_port_t port, uint8_t * value)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+    GPIO_Reg_S * port_regs = NULL_PTR;
+
+    /* Check if the Pointer is NULL pointer */
+    if(value != NULL_PTR)
+    {
+        /* Check if the Port is existed or not */
+        if(port < PORT_MAX)
+        {
+            /* Get the registers of the Port once, then the Pins levels */
+            port_regs = GPIO_PORT_BASE(port);
+            *value = ((IO_ACCESS(port_regs)->PIN).reg);
+        }
+        else
+        {
+            /* The Port value is not existed */
+            GPIO_status = VALUE_IS_NOT_EXISTED;
+        }
+    }
+    else
+    {
+        /* The pointer is Null Pointer */
+        GPIO_status = PTR_USED_IS_NULL_PTR;
+    }
+
+    /* Return API status */
+    return GPIO_status;
+}
+
+/**
+ * @brief This API is used to read the levels of all pins of all ports.
+ * @param values A pointer to array of PORT_MAX bytes which will hold the pins levels of each port (bit per pin).
+ * @example GPIO_read_all_ports(values) then values[PORT_B] holds the levels of PORT_B pins.
+ * @return The levels of all Ports pins and the status of the API (DRIVER_IS_OK or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t GPIO_read_all_ports(uint8_t * values)
+{
+    driver_status_t GPIO_status = DRIVER_IS_OK;
+
+    /* Check if the Pointer is NULL pointer */
+    if(values != NULL_PTR)
+    {
+        /* Get the Pins levels of each port */
+        values[PORT_A] = ((IO_ACCESS(GPIO_A_REGS)->PIN).reg);
+        values[PORT_B] = ((IO_ACCESS(GPIO_B_REGS)->PIN).reg);
+        values[PORT_C] = ((IO_ACCESS(GPIO_C_REGS)->PIN).reg);
+        values[PORT_D] = ((IO_ACCESS(GPIO_D_REGS)->PIN).reg);
+    }
+    else
+    {
+        /* The pointer is Null Pointer */
+        GPIO_status = PTR_USED_IS_NULL_PTR;
+    }
+
+    /* Return API status */
+    return GPIO_status;
+}
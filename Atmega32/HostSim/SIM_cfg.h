@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 10:03:12                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 10:03:12                              *
+ * @FilePath              : SIM_cfg.h                                        *
+ ****************************************************************************/
+
+#ifndef HOSTSIM_SIM_CFG_H_
+#define HOSTSIM_SIM_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Simulated CPU Cycles consumed by each register access.
+ * @note The simulated time is advanced only by register accesses, SIM_advance and SIM_sleep.
+ */
+
+#define SIM_CYCLES_PER_ACCESS           2U
+
+/**
+ * @brief EEPROM Programming Time in CPU Cycles (default value can be changed by SIM_set_eeprom_program_time).
+ * @note Atmega32 needs 8448 cycles of the calibrated 1MHz RC oscillator (about 8.5 ms) to program one byte.
+ * @note Default value is 8.5 ms at 8MHz CPU clock.
+ */
+
+#define SIM_EEPROM_PROGRAM_CYCLES       68000UL
+
+/**
+ * @brief EEPROM Master Write Enable window in CPU Cycles.
+ * @note EEWE must be set within that window after setting EEMWE, otherwise the write is ignored.
+ */
+
+#define SIM_EEMWE_WINDOW_CYCLES         4U
+
+#endif
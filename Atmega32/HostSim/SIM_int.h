@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 10:02:41                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 22:36:00                              *
+ * @FilePath              : SIM_int.h                                        *
+ ****************************************************************************/
+
+#ifndef HOSTSIM_SIM_INT_H_
+#define HOSTSIM_SIM_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Simulated I/O Space Size (Register File and I/O Registers, Data Space Addresses 0x00 -> 0x5F).
+ */
+#define SIM_IO_SPACE_SIZE       0x60U
+
+/**
+ * @brief Simulated Data Space Size (up to the last SRAM Address 0x85F) and the simulated end of .data and .bss sections,
+ * the SRAM above that address is free for the stack.
+ */
+#define SIM_DATA_SPACE_SIZE     0x860U
+#define SIM_DATA_END_ADDRESS    0x0200U
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Sleep Hook which replaces the sleep instruction.
+ * @note It is called with the Sleep Mode Select bits value (MCUCR.SM).
+ */
+typedef void (*sim_sleep_hook_t)(uint8_t mode);
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Simulated I/O Space which holds all the Atmega32 registers at their data space addresses.
+ */
+extern volatile uint8_t SIM_io_space[SIM_IO_SPACE_SIZE];
+
+/**
+ * @brief Simulated SRAM at its data space addresses (the I/O Space part is not used), the stack pointer is only
+ * the value of SPH:SPL so the tests write the stack bytes themselves.
+ */
+extern volatile uint8_t SIM_data_space[SIM_DATA_SPACE_SIZE];
+
+
+/**
+ * @section APIs
+ */
+
+void              SIM_reset                  (void);
+volatile void *   SIM_io_access              (volatile void * reg);
+void              SIM_advance                (uint32_t cycles);
+uint32_t          SIM_get_cycles             (void);
+void              SIM_sleep                  (void);
+void              SIM_set_sleep_hook         (sim_sleep_hook_t hook);
+void              SIM_set_eeprom_program_time(uint32_t cycles);
+void              SIM_set_eeprom_ready_delay (uint8_t accesses);
+uint8_t           SIM_eeprom_peek            (uint16_t address);
+void              SIM_eeprom_poke            (uint16_t address, uint8_t byte);
+uint32_t          SIM_get_eeprom_writes      (void);
+driver_status_t   SIM_drive_pins             (uint8_t port, uint8_t mask, uint8_t level);
+driver_status_t   SIM_release_pins           (uint8_t port, uint8_t mask);
+
+#endif
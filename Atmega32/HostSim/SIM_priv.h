@@ -0,0 +1,51 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 10:03:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 20:20:00                              *
+ * @FilePath              : SIM_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef HOSTSIM_SIM_PRIV_H_
+#define HOSTSIM_SIM_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Simulated EEPROM
+ */
+
+#define SIM_EEPROM_SIZE                 1024U
+#define SIM_EEPROM_ADDRESS_MASK         0x03FFU
+#define SIM_EEPROM_ERASED_VALUE         0xFFU
+#define SIM_EEPROM_ADDRESS_MOST_BYTE    8U
+
+/**
+ * @brief Simulated GPIO Ports
+ */
+
+#define SIM_PORTS_NUMBER                4U
+#define SIM_PORT_NOT_DRIVEN             0x00U
+#define SIM_PORT_ALL_PINS               0xFFU
+
+/**
+ * @brief Simulated Interrupts
+ */
+
+#define SIM_NOT_IN_INTERRUPT            0U
+#define SIM_IN_INTERRUPT                1U
+
+/**
+ * @brief Simulated Timers
+ */
+
+#define SIM_CLOCK_SELECT_OPTIONS        8U
+#define SIM_TIMER_STOPPED               0U
+#define SIM_NO_REGISTER                 0xFFU
+#define SIM_TIMER_MOST_BYTE             8U
+#define SIM_TIMER0_TOP_TICKS            256U
+#define SIM_TIMER1_TOP_TICKS            65536UL
+
+#endif
@@ -0,0 +1,696 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 10:04:18                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 22:36:00                              *
+ * @FilePath              : SIM_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "SIM_int.h"
+#include "SIM_priv.h"
+#include "SIM_cfg.h"
+
+#if defined(HOST_SIM)
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Access the simulated registers directly (without running the behavioral models).
+ */
+#define SIM_SREG        ((volatile SREG_t *) &SIM_io_space[SREG_ADDRESS])
+#define SIM_MCUCR       ((volatile MCUCR_t *) &SIM_io_space[MCUCR_ADDRESS])
+#define SIM_SFIOR       ((volatile SFIOR_t *) &SIM_io_space[SFIOR_ADDRESS])
+#define SIM_EEPROM      ((EEPROM_Reg_S *) &SIM_io_space[EEPROM_BASE_ADDRESS])
+#define SIM_TCCR1B      ((volatile TCCR1B_t *) &SIM_io_space[TCCR1B_ADDRESS])
+#define SIM_TCCR0       ((volatile TCCR0_t *) &SIM_io_space[TCCR0_ADDRESS])
+#define SIM_TIMSK       ((volatile TIMSK_t *) &SIM_io_space[TIMSK_ADDRESS])
+#define SIM_TIFR        ((volatile TIFR_t *) &SIM_io_space[TIFR_ADDRESS])
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Simulated I/O Space.
+ */
+volatile uint8_t SIM_io_space[SIM_IO_SPACE_SIZE];
+
+/**
+ * @brief Simulated SRAM.
+ */
+volatile uint8_t SIM_data_space[SIM_DATA_SPACE_SIZE];
+
+/**
+ * @brief Simulated GPIO Ports (same order as gpio_port_t).
+ */
+static GPIO_Reg_S * const SIM_ports[SIM_PORTS_NUMBER] =
+{
+    GPIO_A_REGS,
+    GPIO_B_REGS,
+    GPIO_C_REGS,
+    GPIO_D_REGS
+};
+
+/**
+ * @brief External levels injected on the pins of each port (only pins in the driven mask are driven).
+ */
+static uint8_t SIM_pins_driven[SIM_PORTS_NUMBER];
+static uint8_t SIM_pins_level[SIM_PORTS_NUMBER];
+
+/**
+ * @brief Simulated Time.
+ */
+static uint32_t SIM_cycles = 0U;
+static uint32_t SIM_last_access_cycles = 0U;
+
+/**
+ * @brief Simulated EEPROM Memory and its programming state.
+ */
+static uint8_t  SIM_eeprom[SIM_EEPROM_SIZE];
+static uint32_t SIM_eeprom_program_cycles = SIM_EEPROM_PROGRAM_CYCLES;
+static uint32_t SIM_eeprom_ready_cycles = 0U;
+static uint32_t SIM_eeprom_writes = 0U;
+static uint32_t SIM_eemwe_cycles = 0U;
+static uint8_t  SIM_eemwe_armed = CLEAR_VALUE;
+static EECR_t   SIM_eecr_shadow;
+static uint8_t  SIM_eeprom_ready_delay = 0U;
+static uint8_t  SIM_eeprom_ready_countdown = 0U;
+
+/**
+ * @brief Simulated Timer/Counter0 and Timer/Counter1 state.
+ */
+static uint32_t SIM_timer0_cycles = 0U;
+static uint32_t SIM_timer0_remainder = 0U;
+static uint32_t SIM_timer1_cycles = 0U;
+static uint32_t SIM_timer1_remainder = 0U;
+static uint32_t SIM_timer1_overflows = 0U;
+static const uint16_t SIM_timer_prescalers[SIM_CLOCK_SELECT_OPTIONS] =
+{
+    SIM_TIMER_STOPPED, 1U, 8U, 64U, 256U, 1024U, SIM_TIMER_STOPPED, SIM_TIMER_STOPPED
+};
+
+/**
+ * @brief Simulated Sleep and Interrupts state.
+ */
+static sim_sleep_hook_t SIM_sleep_hook = NULL_PTR;
+static uint8_t SIM_interrupt_state = SIM_NOT_IN_INTERRUPT;
+
+/**
+ * @brief Interrupt Service Routines which are served by the simulator (if they are linked).
+ */
+extern void EE_RDY_VECT(void) __attribute__((weak));
+extern void TIMER0_COMP_VECT(void) __attribute__((weak));
+extern void TIMER1_OVF_VECT(void) __attribute__((weak));
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to run an Interrupt Service Routine as the CPU does.
+ * @param vector The Interrupt Service Routine.
+ */
+static void SIM_run_interrupt(void (*vector)(void))
+{
+    /* Global Interrupt is disabled during the routine and no nested interrupts are simulated */
+    SIM_interrupt_state = SIM_IN_INTERRUPT;
+    ((SIM_SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+
+    vector();
+
+    /* Return from interrupt enables Global Interrupt again */
+    ((SIM_SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    SIM_interrupt_state = SIM_NOT_IN_INTERRUPT;
+}
+
+/**
+ * @brief This function is used to run EEPROM behavioral model.
+ * @note Writes done by the driver are seen at the next access, so they are stamped by the previous access time.
+ */
+static void SIM_update_eeprom(void)
+{
+    uint16_t address = (uint16_t)((((uint16_t)((SIM_EEPROM->EEARH).reg)) << SIM_EEPROM_ADDRESS_MOST_BYTE) |
+                                  ((SIM_EEPROM->EEARL).reg)) & SIM_EEPROM_ADDRESS_MASK;
+
+    /* Check if EEPROM Master Write Enable has been set */
+    if (((((SIM_EEPROM->EECR).bits).EEMWE) == SET_VALUE) && ((SIM_eecr_shadow.bits).EEMWE == CLEAR_VALUE))
+    {
+        SIM_eemwe_armed = SET_VALUE;
+        SIM_eemwe_cycles = SIM_last_access_cycles;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Check if EEPROM Write Enable has been set */
+    if (((((SIM_EEPROM->EECR).bits).EEWE) == SET_VALUE) && ((SIM_eecr_shadow.bits).EEWE == CLEAR_VALUE))
+    {
+        /* Check if EEPROM Master Write Enable was set within its window */
+        if ((SIM_eemwe_armed == SET_VALUE) && ((SIM_last_access_cycles - SIM_eemwe_cycles) <= SIM_EEMWE_WINDOW_CYCLES))
+        {
+            /* Program the data and start the programming time */
+            SIM_eeprom[address] = ((SIM_EEPROM->EEDR).reg);
+            SIM_eeprom_ready_cycles = SIM_last_access_cycles + SIM_eeprom_program_cycles;
+            SIM_eeprom_writes++;
+        }
+        else
+        {
+            /* Write is ignored by hardware */
+            (((SIM_EEPROM->EECR).bits).EEWE) = CLEAR_VALUE;
+        }
+    }
+    /* Check if the programming time has been finished */
+    else if (((((SIM_EEPROM->EECR).bits).EEWE) == SET_VALUE) && ((int32_t)(SIM_cycles - SIM_eeprom_ready_cycles) >= 0))
+    {
+        /* EEWE is cleared by hardware, EEPROM Ready Interrupt may be served some accesses later */
+        (((SIM_EEPROM->EECR).bits).EEWE) = CLEAR_VALUE;
+        SIM_eeprom_ready_countdown = SIM_eeprom_ready_delay;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* EEPROM Master Write Enable is cleared by hardware after its window */
+    if ((SIM_eemwe_armed == SET_VALUE) && ((SIM_cycles - SIM_eemwe_cycles) > SIM_EEMWE_WINDOW_CYCLES))
+    {
+        SIM_eemwe_armed = CLEAR_VALUE;
+        (((SIM_EEPROM->EECR).bits).EEMWE) = CLEAR_VALUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Check if EEPROM Read Enable has been set */
+    if ((((SIM_EEPROM->EECR).bits).EERE) == SET_VALUE)
+    {
+        /* Data is latched only if there is no writing process going on */
+        if ((((SIM_EEPROM->EECR).bits).EEWE) == CLEAR_VALUE)
+        {
+            ((SIM_EEPROM->EEDR).reg) = SIM_eeprom[address];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        /* EERE is cleared by hardware */
+        (((SIM_EEPROM->EECR).bits).EERE) = CLEAR_VALUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Store EECR to detect the next writes */
+    SIM_eecr_shadow.reg = ((SIM_EEPROM->EECR).reg);
+}
+
+/**
+ * @brief This function is used to run GPIO behavioral model.
+ * @note PIN reflects the driven level for output pins, and the external level, the pull-up or low level for input pins.
+ */
+static void SIM_update_gpio(void)
+{
+    uint8_t port = 0U;
+    uint8_t ddr = 0U;
+    uint8_t output = 0U;
+    uint8_t pull_up = 0U;
+
+    for (port = 0U; port < SIM_PORTS_NUMBER; port++)
+    {
+        ddr = ((SIM_ports[port]->DDR).reg);
+        output = ((SIM_ports[port]->PORT).reg);
+
+        /* Check if Pull-up is disabled for all ports */
+        pull_up = (((SIM_SFIOR->bits).PUD) == CLEAR_VALUE) ? ((uint8_t)(~ddr & output)) : SIM_PORT_NOT_DRIVEN;
+
+        ((SIM_ports[port]->PIN).reg) = (uint8_t)((ddr & output) |
+                                                 (~ddr & SIM_pins_driven[port] & SIM_pins_level[port]) |
+                                                 (~ddr & ~SIM_pins_driven[port] & pull_up));
+    }
+}
+
+/**
+ * @brief This function is used to run Timer/Counter1 behavioral model.
+ * @param accessed The data space address of the accessed register.
+ * @note The counter is not advanced when its High byte is accessed, so reading Low byte then High byte
+ * gives a consistent value as the TEMP register does.
+ * @note The Overflow Flag is set when the counter wraps, the wraps are counted while Global Interrupt is enabled
+ * (each one is served by an interrupt), otherwise only the flag is kept as the hardware does.
+ * @note External clock sources are not simulated.
+ */
+static void SIM_update_timer1(uint8_t accessed)
+{
+    uint16_t prescaler = SIM_timer_prescalers[((SIM_TCCR1B->bits).CS1)];
+    uint32_t ticks = 0U;
+    uint16_t counter = 0U;
+
+    /* Accumulate the elapsed cycles */
+    SIM_timer1_remainder += (SIM_cycles - SIM_timer1_cycles);
+    SIM_timer1_cycles = SIM_cycles;
+
+    /* Check if Timer is stopped */
+    if (prescaler == SIM_TIMER_STOPPED)
+    {
+        SIM_timer1_remainder = 0U;
+    }
+    else if (accessed != TCNT1H_ADDRESS)
+    {
+        ticks = SIM_timer1_remainder / prescaler;
+        SIM_timer1_remainder = SIM_timer1_remainder % prescaler;
+
+        /* Count the ticks */
+        counter = (uint16_t)(((uint16_t)SIM_io_space[TCNT1H_ADDRESS] << SIM_TIMER_MOST_BYTE) | SIM_io_space[TCNT1L_ADDRESS]);
+
+        /* Check if the counter wraps */
+        if ((counter + ticks) >= SIM_TIMER1_TOP_TICKS)
+        {
+            ((SIM_TIFR->bits).TOV1) = SET_VALUE;
+            if (((SIM_SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE)
+            {
+                SIM_timer1_overflows += (uint32_t)((counter + ticks) / SIM_TIMER1_TOP_TICKS);
+            }
+            else if (SIM_timer1_overflows == 0U)
+            {
+                SIM_timer1_overflows = 1U;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        counter = (uint16_t)(counter + ticks);
+        SIM_io_space[TCNT1H_ADDRESS] = (uint8_t)(counter >> SIM_TIMER_MOST_BYTE);
+        SIM_io_space[TCNT1L_ADDRESS] = (uint8_t)counter;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief This function is used to get the number of Timer/Counter0 ticks until the next compare match.
+ * @return The number of ticks (1 -> 256).
+ */
+static uint16_t SIM_timer0_compare_ticks(void)
+{
+    uint16_t ticks = (uint8_t)(SIM_io_space[OCR0_ADDRESS] - SIM_io_space[TCNT0_ADDRESS]);
+
+    /* Check if the counter is at the compare value */
+    if (ticks == 0U)
+    {
+        /* The next match is after a full period */
+        ticks = ((((SIM_TCCR0->bits).WGM01) == SET_VALUE) && (((SIM_TCCR0->bits).WGM00) == CLEAR_VALUE)) ?
+                (uint16_t)(SIM_io_space[OCR0_ADDRESS] + 1U) : SIM_TIMER0_TOP_TICKS;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return ticks;
+}
+
+/**
+ * @brief This function is used to run Timer/Counter0 behavioral model.
+ * @note Normal and CTC Modes are simulated, the Compare Match Flag is set when the counter reaches OCR0.
+ * @note External clock sources and PWM Modes are not simulated.
+ */
+static void SIM_update_timer0(void)
+{
+    uint16_t prescaler = SIM_timer_prescalers[((SIM_TCCR0->bits).CS0)];
+    uint16_t compare_ticks = 0U;
+    uint32_t ticks = 0U;
+
+    /* Accumulate the elapsed cycles */
+    SIM_timer0_remainder += (SIM_cycles - SIM_timer0_cycles);
+    SIM_timer0_cycles = SIM_cycles;
+
+    /* Check if Timer is stopped */
+    if (prescaler == SIM_TIMER_STOPPED)
+    {
+        SIM_timer0_remainder = 0U;
+    }
+    else
+    {
+        ticks = SIM_timer0_remainder / prescaler;
+        SIM_timer0_remainder = SIM_timer0_remainder % prescaler;
+        compare_ticks = SIM_timer0_compare_ticks();
+
+        /* Check if the counter reaches the compare value */
+        if (ticks >= compare_ticks)
+        {
+            ((SIM_TIFR->bits).OCF0) = SET_VALUE;
+
+            /* Check if CTC Mode is used */
+            if ((((SIM_TCCR0->bits).WGM01) == SET_VALUE) && (((SIM_TCCR0->bits).WGM00) == CLEAR_VALUE))
+            {
+                SIM_io_space[TCNT0_ADDRESS] = (uint8_t)((ticks - compare_ticks) % (SIM_io_space[OCR0_ADDRESS] + 1U));
+            }
+            else
+            {
+                SIM_io_space[TCNT0_ADDRESS] = (uint8_t)(SIM_io_space[TCNT0_ADDRESS] + ticks);
+            }
+        }
+        else
+        {
+            SIM_io_space[TCNT0_ADDRESS] = (uint8_t)(SIM_io_space[TCNT0_ADDRESS] + ticks);
+        }
+    }
+}
+
+/**
+ * @brief This function is used to run all behavioral models and serve the pending interrupts.
+ * @param accessed The data space address of the accessed register (SIM_NO_REGISTER if there is no access).
+ */
+static void SIM_update(uint8_t accessed)
+{
+    SIM_update_eeprom();
+    SIM_update_gpio();
+    SIM_update_timer0();
+    SIM_update_timer1(accessed);
+
+    /* Check if Timer/Counter1 Overflow Interrupt is pending (it has higher priority than Timer/Counter0 and EEPROM) */
+    if ((SIM_interrupt_state == SIM_NOT_IN_INTERRUPT) && (((SIM_SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE) &&
+        (((SIM_TIMSK->bits).TOIE1) == SET_VALUE) && (((SIM_TIFR->bits).TOV1) == SET_VALUE) &&
+        (TIMER1_OVF_VECT != NULL_PTR))
+    {
+        /* The flag is cleared by hardware when the vector is executed, one vector is executed per wrap */
+        ((SIM_TIFR->bits).TOV1) = CLEAR_VALUE;
+        while (SIM_timer1_overflows > 0U)
+        {
+            SIM_timer1_overflows--;
+            SIM_run_interrupt(TIMER1_OVF_VECT);
+        }
+    }
+    /* Check if Timer/Counter0 Compare Match Interrupt is pending (it has higher priority than EEPROM Ready) */
+    else if ((SIM_interrupt_state == SIM_NOT_IN_INTERRUPT) && (((SIM_SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE) &&
+        (((SIM_TIMSK->bits).OCIE0) == SET_VALUE) && (((SIM_TIFR->bits).OCF0) == SET_VALUE) &&
+        (TIMER0_COMP_VECT != NULL_PTR))
+    {
+        /* The flag is cleared by hardware when the vector is executed */
+        ((SIM_TIFR->bits).OCF0) = CLEAR_VALUE;
+        SIM_run_interrupt(TIMER0_COMP_VECT);
+    }
+    /* Check if EEPROM Ready Interrupt is delayed (the delay is counted in register accesses) */
+    else if (SIM_eeprom_ready_countdown != 0U)
+    {
+        if (accessed != SIM_NO_REGISTER)
+        {
+            SIM_eeprom_ready_countdown--;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    /* Check if EEPROM Ready Interrupt is pending */
+    else if ((SIM_interrupt_state == SIM_NOT_IN_INTERRUPT) && (((SIM_SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE) &&
+             ((((SIM_EEPROM->EECR).bits).EERIE) == SET_VALUE) && ((((SIM_EEPROM->EECR).bits).EEWE) == CLEAR_VALUE) &&
+             (EE_RDY_VECT != NULL_PTR))
+    {
+        SIM_run_interrupt(EE_RDY_VECT);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to reset the simulator (registers, cleared SRAM, erased EEPROM, released pins and time).
+ */
+void SIM_reset(void)
+{
+    uint16_t index = 0U;
+
+    for (index = 0U; index < SIM_IO_SPACE_SIZE; index++)
+    {
+        SIM_io_space[index] = CLEAR_VALUE;
+    }
+    for (index = 0U; index < SIM_DATA_SPACE_SIZE; index++)
+    {
+        SIM_data_space[index] = CLEAR_VALUE;
+    }
+    for (index = 0U; index < SIM_EEPROM_SIZE; index++)
+    {
+        SIM_eeprom[index] = SIM_EEPROM_ERASED_VALUE;
+    }
+    for (index = 0U; index < SIM_PORTS_NUMBER; index++)
+    {
+        SIM_pins_driven[index] = SIM_PORT_NOT_DRIVEN;
+        SIM_pins_level[index] = SIM_PORT_NOT_DRIVEN;
+    }
+
+    SIM_cycles = 0U;
+    SIM_last_access_cycles = 0U;
+    SIM_timer0_cycles = 0U;
+    SIM_timer0_remainder = 0U;
+    SIM_timer1_cycles = 0U;
+    SIM_timer1_remainder = 0U;
+    SIM_timer1_overflows = 0U;
+    SIM_eeprom_program_cycles = SIM_EEPROM_PROGRAM_CYCLES;
+    SIM_eeprom_ready_cycles = 0U;
+    SIM_eeprom_writes = 0U;
+    SIM_eemwe_armed = CLEAR_VALUE;
+    SIM_eecr_shadow.reg = CLEAR_VALUE;
+    SIM_eeprom_ready_delay = 0U;
+    SIM_eeprom_ready_countdown = 0U;
+    SIM_sleep_hook = NULL_PTR;
+    SIM_interrupt_state = SIM_NOT_IN_INTERRUPT;
+}
+
+/**
+ * @brief This API is called by the register access macros before each register access.
+ * @param reg A pointer to the accessed register.
+ * @return The same pointer after the behavioral models have been updated.
+ */
+volatile void * SIM_io_access(volatile void * reg)
+{
+    /* Each access consumes CPU time */
+    SIM_cycles += SIM_CYCLES_PER_ACCESS;
+
+    /* Apply the effects of the previous writes */
+    SIM_update((uint8_t)((volatile uint8_t *)reg - SIM_io_space));
+
+    /* Stamp that access */
+    SIM_last_access_cycles = SIM_cycles;
+
+    return reg;
+}
+
+/**
+ * @brief This API is used to advance the simulated time without accessing any register.
+ * @param cycles The number of CPU cycles.
+ */
+void SIM_advance(uint32_t cycles)
+{
+    SIM_cycles += cycles;
+    SIM_update(SIM_NO_REGISTER);
+}
+
+/**
+ * @brief This API is used to get the simulated time.
+ * @return The number of CPU cycles since the last reset.
+ */
+uint32_t SIM_get_cycles(void)
+{
+    return SIM_cycles;
+}
+
+/**
+ * @brief This API replaces the sleep instruction.
+ * @note If no sleep hook is set, the CPU sleeps until the first wake-up interrupt (the running EEPROM write by
+ * EEPROM Ready Interrupt, the next Timer/Counter0 Compare Match or the next Timer/Counter1 Overflow), the timers are
+ * assumed to keep running.
+ */
+void SIM_sleep(void)
+{
+    uint32_t sleep_cycles = 0U;
+    uint32_t wakeup_cycles = 0U;
+    uint16_t prescaler = SIM_timer_prescalers[((SIM_TCCR0->bits).CS0)];
+    uint16_t timer1_prescaler = SIM_timer_prescalers[((SIM_TCCR1B->bits).CS1)];
+    uint16_t counter = 0U;
+
+    /* Check if Sleep Mode is enabled */
+    if (((SIM_MCUCR->bits).SE) == SET_VALUE)
+    {
+        if (SIM_sleep_hook != NULL_PTR)
+        {
+            SIM_sleep_hook((uint8_t)((SIM_MCUCR->bits).SM));
+        }
+        else
+        {
+            /* Check if a wake-up interrupt will come from EEPROM */
+            if (((((SIM_EEPROM->EECR).bits).EEWE) == SET_VALUE) && ((((SIM_EEPROM->EECR).bits).EERIE) == SET_VALUE) &&
+                ((int32_t)(SIM_eeprom_ready_cycles - SIM_cycles) > 0))
+            {
+                sleep_cycles = SIM_eeprom_ready_cycles - SIM_cycles;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Check if a wake-up interrupt will come from Timer/Counter0 */
+            if ((((SIM_TIMSK->bits).OCIE0) == SET_VALUE) && (prescaler != SIM_TIMER_STOPPED))
+            {
+                wakeup_cycles = ((uint32_t)SIM_timer0_compare_ticks() * prescaler) - SIM_timer0_remainder;
+                sleep_cycles = ((sleep_cycles == 0U) || (wakeup_cycles < sleep_cycles)) ? wakeup_cycles : sleep_cycles;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Check if a wake-up interrupt will come from Timer/Counter1 */
+            if ((((SIM_TIMSK->bits).TOIE1) == SET_VALUE) && (timer1_prescaler != SIM_TIMER_STOPPED))
+            {
+                counter = (uint16_t)(((uint16_t)SIM_io_space[TCNT1H_ADDRESS] << SIM_TIMER_MOST_BYTE) | SIM_io_space[TCNT1L_ADDRESS]);
+                wakeup_cycles = ((SIM_TIMER1_TOP_TICKS - counter) * timer1_prescaler) - SIM_timer1_remainder;
+                sleep_cycles = ((sleep_cycles == 0U) || (wakeup_cycles < sleep_cycles)) ? wakeup_cycles : sleep_cycles;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            SIM_advance(sleep_cycles);
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief This API is used to replace the default sleep behavior.
+ * @param hook The function which is called instead of the sleep instruction (NULL_PTR restores the default).
+ */
+void SIM_set_sleep_hook(sim_sleep_hook_t hook)
+{
+    SIM_sleep_hook = hook;
+}
+
+/**
+ * @brief This API is used to set the EEPROM programming time.
+ * @param cycles The number of CPU cycles needed to program one byte.
+ */
+void SIM_set_eeprom_program_time(uint32_t cycles)
+{
+    SIM_eeprom_program_cycles = cycles;
+}
+
+/**
+ * @brief This API is used to delay EEPROM Ready Interrupt after each programmed byte.
+ * @param accesses The number of register accesses which run after EEWE is cleared before the interrupt is served
+ * (0 serves it at once).
+ * @note On hardware, the interrupt can come after any instruction which follows the end of the programming time,
+ * e.g. right after the driver has seen EEWE cleared, so a delay of 1 exposes the gap between a check of EEWE
+ * and the next accesses.
+ */
+void SIM_set_eeprom_ready_delay(uint8_t accesses)
+{
+    SIM_eeprom_ready_delay = accesses;
+}
+
+/**
+ * @brief This API is used to read the simulated EEPROM without the driver.
+ * @param address The EEPROM address (0 -> 1023).
+ * @return The stored byte.
+ */
+uint8_t SIM_eeprom_peek(uint16_t address)
+{
+    return SIM_eeprom[address & SIM_EEPROM_ADDRESS_MASK];
+}
+
+/**
+ * @brief This API is used to write the simulated EEPROM without the driver and without programming time.
+ * @param address The EEPROM address (0 -> 1023).
+ * @param byte The byte to be stored.
+ */
+void SIM_eeprom_poke(uint16_t address, uint8_t byte)
+{
+    SIM_eeprom[address & SIM_EEPROM_ADDRESS_MASK] = byte;
+}
+
+/**
+ * @brief This API is used to get the number of programmed EEPROM bytes (write cycles).
+ * @return The number of programmed bytes since the last reset.
+ */
+uint32_t SIM_get_eeprom_writes(void)
+{
+    return SIM_eeprom_writes;
+}
+
+/**
+ * @brief This API is used to drive external levels on input pins.
+ * @param port The port index (0 for PORT_A -> 3 for PORT_D).
+ * @param mask The driven pins.
+ * @param level The levels of the driven pins (bit per pin).
+ * @return The status of the simulator (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t SIM_drive_pins(uint8_t port, uint8_t mask, uint8_t level)
+{
+    driver_status_t SIM_status = DRIVER_IS_OK;
+
+    if (port < SIM_PORTS_NUMBER)
+    {
+        SIM_pins_driven[port] |= mask;
+        SIM_pins_level[port] = (uint8_t)((SIM_pins_level[port] & ~mask) | (level & mask));
+    }
+    else
+    {
+        /* Port value is not existed */
+        SIM_status = VALUE_IS_NOT_EXISTED;
+    }
+
+    return SIM_status;
+}
+
+/**
+ * @brief This API is used to stop driving external levels on input pins.
+ * @param port The port index (0 for PORT_A -> 3 for PORT_D).
+ * @param mask The released pins.
+ * @return The status of the simulator (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t SIM_release_pins(uint8_t port, uint8_t mask)
+{
+    driver_status_t SIM_status = DRIVER_IS_OK;
+
+    if (port < SIM_PORTS_NUMBER)
+    {
+        SIM_pins_driven[port] &= (uint8_t)(~mask);
+    }
+    else
+    {
+        /* Port value is not existed */
+        SIM_status = VALUE_IS_NOT_EXISTED;
+    }
+
+    return SIM_status;
+}
+
+#endif
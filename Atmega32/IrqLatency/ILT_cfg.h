@@ -0,0 +1,25 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 17:52:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 17:52:40                              *
+ * @FilePath              : ILT_cfg.h                                        *
+ ****************************************************************************/
+
+#ifndef IRQLATENCY_ILT_CFG_H_
+#define IRQLATENCY_ILT_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Histogram Bin Width
+ * @note Each bin covers (1 << ILT_BIN_WIDTH_SHIFT) ticks, e.g. 3 with TB_PRESCALER_1 gives bins of 8 cycles
+ * (0 -> 7, 8 -> 15, ... and 56 cycles or more in the last bin).
+ * @note Minimum value is 0 and Maximum value is 12.
+ */
+
+#define ILT_BIN_WIDTH_SHIFT     3U
+
+#endif
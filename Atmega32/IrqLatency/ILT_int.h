@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 17:52:14                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 21:28:00                              *
+ * @FilePath              : ILT_int.h                                        *
+ ****************************************************************************/
+
+#ifndef IRQLATENCY_ILT_INT_H_
+#define IRQLATENCY_ILT_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Number of histogram bins per site (the width of a bin is set by ILT_BIN_WIDTH_SHIFT).
+ */
+#define ILT_HISTOGRAM_BINS      8U
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Sites which disable or enable Global Interrupt
+ */
+typedef enum
+{
+    ILT_EEPROM_WRITE_BYTE = (uint8_t)0,
+    ILT_EEPROM_WAIT_READY             ,
+    ILT_EEPROM_WRITE_ASYNC            ,
+    ILT_EEPROM_ENABLE_INTERRUPT       ,
+    ILT_EEPROM_READ_BLOCK             ,
+    ILT_STK_INIT                      ,
+    ILT_TB_GET_TICKS                  ,
+    ILT_MM_IDLE                       ,
+    ILT_MM_ACQUIRE                    ,
+    ILT_MM_RELEASE                    ,
+    ILT_MM_GET_STATS                  ,
+    ILT_SCH_ADD_TASK                  ,
+    ILT_SCH_DISPATCH                  ,
+    ILT_DEB_GET_EDGES                 ,
+    ILT_BENCH_RUN                     ,
+    ILT_LCAP_CAPTURE                  ,
+    ILT_MAX_SITE
+}ilt_site_t;
+
+/**
+ * @brief Interrupt Latency Statistics of one site
+ * @note Ticks are Timebase ticks while Global Interrupt was disabled (windows longer than 65535 ticks are saturated).
+ */
+typedef struct
+{
+    uint16_t max_ticks;                             /* Longest window                                    */
+    uint16_t last_ticks;                            /* Last window                                       */
+    uint16_t windows;                               /* Number of windows (saturated at 0xFFFF)           */
+    uint16_t histogram[ILT_HISTOGRAM_BINS];         /* Windows per bin, the last bin holds longer windows */
+}ilt_site_stats_t;
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Interrupt Latency Table (readable by symbol from the simulator or the debugger).
+ */
+extern ilt_site_stats_t ILT_sites[ILT_MAX_SITE];
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t ILT_init        (void);
+void            ILT_start       (void);
+void            ILT_stop        (ilt_site_t site);
+driver_status_t ILT_get_stats   (ilt_site_t site, ilt_site_stats_t * stats);
+
+#endif
@@ -0,0 +1,26 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 17:53:05                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 21:28:00                              *
+ * @FilePath              : ILT_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef IRQLATENCY_ILT_PRIV_H_
+#define IRQLATENCY_ILT_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Measurement
+ */
+
+#define ILT_NO_TICKS            0U
+#define ILT_NO_WINDOWS          0U
+#define ILT_MAX_COUNT           0xFFFFU
+#define ILT_MAX_TICKS           0xFFFFU
+#define ILT_LAST_BIN            (ILT_HISTOGRAM_BINS - 1U)
+
+#endif
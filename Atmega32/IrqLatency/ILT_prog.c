@@ -0,0 +1,175 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 17:53:31                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 21:28:00                              *
+ * @FilePath              : ILT_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../Timebase/TB_int.h"
+#include "ILT_int.h"
+#include "ILT_priv.h"
+#include "ILT_cfg.h"
+
+#if ILT_BIN_WIDTH_SHIFT > 12U
+#error "ILT_BIN_WIDTH_SHIFT must be 0 -> 12"
+#endif
+
+#if defined(IRQ_LATENCY_TRACKING)
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Interrupt Latency Table.
+ */
+ilt_site_stats_t ILT_sites[ILT_MAX_SITE];
+
+/**
+ * @brief Timebase ticks at which Global Interrupt has been disabled, and set while that window is open.
+ */
+static uint32_t ILT_start_ticks = ILT_NO_TICKS;
+static uint8_t ILT_is_open = CLEAR_VALUE;
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to clear the interrupt latency table and start the Timebase which measures the windows.
+ * @note The Timebase (Timer/Counter1) is restarted, so it must be called before the scheduler is started.
+ * @return The status of Interrupt Latency Tracker (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t ILT_init(void)
+{
+    driver_status_t ILT_status = DRIVER_IS_OK;
+    uint8_t site = 0U;
+    uint8_t bin = 0U;
+
+    /* Clear the table */
+    for (site = 0U; site < ILT_MAX_SITE; site++)
+    {
+        ILT_sites[site].max_ticks = ILT_NO_TICKS;
+        ILT_sites[site].last_ticks = ILT_NO_TICKS;
+        ILT_sites[site].windows = ILT_NO_WINDOWS;
+        for (bin = 0U; bin < ILT_HISTOGRAM_BINS; bin++)
+        {
+            ILT_sites[site].histogram[bin] = ILT_NO_WINDOWS;
+        }
+    }
+    ILT_is_open = CLEAR_VALUE;
+
+    /* Start the Timebase */
+    ILT_status = TB_init();
+
+    /* Return Interrupt Latency Tracker status */
+    return ILT_status;
+}
+
+/**
+ * @brief This API is used to open a window as Global Interrupt has just been disabled.
+ * @note It is called by ATOMIC_ENTER and IRQ_LATENCY_START, so it must be called with Global Interrupt disabled.
+ */
+void ILT_start(void)
+{
+    ILT_start_ticks = TB_get_ticks32();
+    ILT_is_open = SET_VALUE;
+}
+
+/**
+ * @brief This API is used to close the open window as Global Interrupt is about to be enabled, and record it for the site.
+ * @param site The site which enables Global Interrupt.
+ * @note It is called by ATOMIC_EXIT and IRQ_LATENCY_STOP, nothing is recorded if no window is open or if Global
+ * Interrupt is already enabled (the window has been closed by a site which is not tracked).
+ * @note The windows are opened with Interrupts enabled before, so the table is never updated by an ISR.
+ */
+void ILT_stop(ilt_site_t site)
+{
+    uint32_t window = ILT_NO_TICKS;
+    uint16_t ticks = ILT_NO_TICKS;
+    uint16_t bin = 0U;
+
+    /* Check if the window is open and Interrupts are still disabled */
+    if ((ILT_is_open == SET_VALUE) && (((SREG->bits).I) == GLOBAL_INTERRUPT_DISABLE) && (site < ILT_MAX_SITE))
+    {
+        /* Saturate the long windows (the pending Timebase overflow is seen while Interrupts are disabled) */
+        window = TB_get_ticks32() - ILT_start_ticks;
+        ticks = (window > ILT_MAX_TICKS) ? ILT_MAX_TICKS : (uint16_t)window;
+
+        /* Update the statistics of the site */
+        ILT_sites[site].last_ticks = ticks;
+        if (ticks > ILT_sites[site].max_ticks)
+        {
+            ILT_sites[site].max_ticks = ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (ILT_sites[site].windows < ILT_MAX_COUNT)
+        {
+            ILT_sites[site].windows++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Update the histogram */
+        bin = (uint16_t)(ticks >> ILT_BIN_WIDTH_SHIFT);
+        bin = (bin > ILT_LAST_BIN) ? ILT_LAST_BIN : bin;
+        if (ILT_sites[site].histogram[bin] < ILT_MAX_COUNT)
+        {
+            ILT_sites[site].histogram[bin]++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Close the window */
+    ILT_is_open = CLEAR_VALUE;
+}
+
+/**
+ * @brief This API is used to get the interrupt latency statistics of a site.
+ * @param site The site.
+ * @param stats A pointer to the statistics of the site.
+ * @return The statistics and the status of Interrupt Latency Tracker (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or
+ * PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t ILT_get_stats(ilt_site_t site, ilt_site_stats_t * stats)
+{
+    driver_status_t ILT_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (stats == NULL_PTR)
+    {
+        ILT_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the site is existed or not */
+    else if (site >= ILT_MAX_SITE)
+    {
+        ILT_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        *stats = ILT_sites[site];
+    }
+
+    /* Return Interrupt Latency Tracker status */
+    return ILT_status;
+}
+#endif
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:32:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:42:00                              *
+ * @FilePath              : KV_cfg.h                                         *
+ ****************************************************************************/
+
+#ifndef KEYVALUE_KV_CFG_H_
+#define KEYVALUE_KV_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Key-Value Store Region
+ * @note The region is divided into two halves of KV_HALF_SIZE bytes, the log is appended to the active half and the
+ * newest values are moved to the other half by the compaction.
+ * @note The region (KV_BASE_ADDRESS -> KV_BASE_ADDRESS + 2 * KV_HALF_SIZE - 1) must be in available EEPROM Space (0 -> 1023).
+ */
+
+#define KV_BASE_ADDRESS             512U
+#define KV_HALF_SIZE                256U
+
+/**
+ * @brief Key-Value Store Index Size
+ * @note Maximum number of keys, each key uses 4 bytes of RAM.
+ * @note It must be a power of 2 (2 -> 128), keys less than KV_INDEX_SIZE are found without probing.
+ */
+
+#define KV_INDEX_SIZE               64U
+
+/**
+ * @brief Maximum Value Size in bytes
+ * @note Minimum value is 1 and Maximum value is 254, the compaction uses a RAM buffer of KV_MAX_VALUE_SIZE + 2 bytes.
+ */
+
+#define KV_MAX_VALUE_SIZE           16U
+
+/**
+ * @brief Compaction Threshold in bytes
+ * @note KV_compact starts a compaction when the free bytes of the active half are less than that threshold.
+ */
+
+#define KV_COMPACT_THRESHOLD        32U
+
+/**
+ * @brief Boot Time Timebase
+ * @note It must return uint32_t ticks of a free-running counter, differences are computed in uint32_t.
+ * @note TB_get_ticks32 extends Timer/Counter1 by its overflows count, so a rebuild longer than 65535 ticks is measured.
+ */
+
+#define KV_GET_TICKS()              TB_get_ticks32()
+
+#endif
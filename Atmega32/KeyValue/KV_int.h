@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:31:12                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:42:00                              *
+ * @FilePath              : KV_int.h                                         *
+ ****************************************************************************/
+
+#ifndef KEYVALUE_KV_INT_H_
+#define KEYVALUE_KV_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Key-Value Store Statistics
+ * @note Boot time is measured in ticks of the configured timebase (KV_GET_TICKS) while KV_init rebuilds the index.
+ */
+typedef struct
+{
+    uint32_t boot_ticks;            /* Time taken by KV_init to scan the log and rebuild the index  */
+    uint16_t boot_entries;          /* Number of log entries scanned by KV_init                     */
+    uint8_t  keys;                  /* Number of stored keys                                        */
+    uint16_t live_bytes;            /* Bytes used by the newest values of all keys                  */
+    uint16_t free_bytes;            /* Bytes which can still be appended before a compaction        */
+    uint16_t compactions;           /* Number of compactions since KV_init                          */
+}kv_stats_t;
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Reserved Key (it is the erased EEPROM value which ends the log)
+ */
+#define KV_NO_KEY           0xFFU
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t KV_init     (void);
+driver_status_t KV_get      (uint8_t key, uint8_t * value, uint8_t * length);
+driver_status_t KV_set      (uint8_t key, uint8_t * value, uint8_t length);
+driver_status_t KV_compact  (void);
+driver_status_t KV_get_stats(kv_stats_t * stats);
+
+#endif
@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:33:51                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 16:33:51                              *
+ * @FilePath              : KV_priv.h                                        *
+ ****************************************************************************/
+
+#ifndef KEYVALUE_KV_PRIV_H_
+#define KEYVALUE_KV_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Half Header (generation followed by its complement)
+ * @note A half is valid only if its check byte is the complement of its generation, so erased halves and interrupted
+ * header writes are not valid.
+ */
+
+#define KV_HEADER_SIZE                  2U
+#define KV_HEADER_GENERATION            0U
+#define KV_HEADER_CHECK                 1U
+#define KV_HEADER_CHECK_MASK            0xFFU
+
+/**
+ * @brief Log Entry (key, length then value)
+ * @note The key is written last, so an entry whose write has been interrupted ends the log.
+ */
+
+#define KV_ENTRY_HEADER_SIZE            2U
+#define KV_ENTRY_KEY                    0U
+#define KV_ENTRY_LENGTH                 1U
+#define KV_ENTRY_SIZE(length)           ((uint16_t)(KV_ENTRY_HEADER_SIZE + (length)))
+#define KV_END_OF_LOG                   0xFFU
+
+/**
+ * @brief Halves
+ */
+
+#define KV_HALF_ADDRESS(half)           ((uint16_t)(KV_BASE_ADDRESS + ((half) * KV_HALF_SIZE)))
+#define KV_HALF_END(half)               ((uint16_t)(KV_HALF_ADDRESS(half) + KV_HALF_SIZE))
+#define KV_OTHER_HALF(half)             ((uint8_t)((half) ^ 1U))
+#define KV_NO_HALF                      0xFFU
+
+/**
+ * @brief Index Hash (linear probing)
+ */
+
+#define KV_HASH(key)                    ((uint8_t)((key) & (KV_INDEX_SIZE - 1U)))
+#define KV_NEXT_SLOT(slot)              ((uint8_t)(((slot) + 1U) & (KV_INDEX_SIZE - 1U)))
+
+/**
+ * @brief Set Phases
+ */
+
+#define KV_SET_IDLE                     0U
+#define KV_SET_LENGTH                   1U
+#define KV_SET_VALUE                    2U
+#define KV_SET_END_OF_LOG               3U
+#define KV_SET_KEY                      4U
+
+/**
+ * @brief Compaction Phases
+ */
+
+#define KV_COMPACT_IDLE                 0U
+#define KV_COMPACT_COPY                 1U
+#define KV_COMPACT_END_OF_LOG           2U
+#define KV_COMPACT_HEADER               3U
+
+
+/**
+ * @section Private Typedefs
+ */
+
+/**
+ * @brief Index Entry
+ * @note Empty entries have KV_NO_KEY key.
+ */
+typedef struct
+{
+    uint8_t  key;                   /* Key of the entry                                 */
+    uint8_t  length;                /* Length of the newest value                       */
+    uint16_t address;               /* Address of the newest log entry of the key       */
+}kv_index_entry_t;
+
+#endif
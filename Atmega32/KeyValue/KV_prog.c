@@ -0,0 +1,744 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 16:35:08                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:42:00                              *
+ * @FilePath              : KV_prog.c                                        *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../EEPROM/EEPROM_int.h"
+#include "../EEPROM/EEPROM_priv.h"
+#include "../EEPROM/EEPROM_cfg.h"
+#include "../Timebase/TB_int.h"
+#include "KV_int.h"
+#include "KV_priv.h"
+#include "KV_cfg.h"
+
+#if ((KV_INDEX_SIZE & (KV_INDEX_SIZE - 1U)) != 0U) || (KV_INDEX_SIZE < 2U) || (KV_INDEX_SIZE > 128U)
+#error "KV_INDEX_SIZE must be a power of 2 (2 -> 128)"
+#endif
+
+#if (KV_BASE_ADDRESS + (2U * KV_HALF_SIZE) - 1U) > EEPROM_LAST_LOCATION
+#error "Key-Value Store region must be in available EEPROM Space"
+#endif
+
+#if (KV_MAX_VALUE_SIZE < 1U) || (KV_MAX_VALUE_SIZE > 254U) || ((KV_HEADER_SIZE + KV_ENTRY_HEADER_SIZE + KV_MAX_VALUE_SIZE) > KV_HALF_SIZE)
+#error "KV_MAX_VALUE_SIZE must be 1 -> 254 and its entry must fit in a half"
+#endif
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Index of the newest log entry of each key.
+ */
+static kv_index_entry_t KV_index[KV_INDEX_SIZE];
+
+/**
+ * @brief Active half, its generation and the address at which the next entry is appended.
+ */
+static uint8_t KV_active_half = KV_NO_HALF;
+static uint8_t KV_generation = 0U;
+static uint16_t KV_log_end = 0U;
+
+/**
+ * @brief Statistics of the store.
+ */
+static kv_stats_t KV_stats;
+
+/**
+ * @brief State of the running set (TIME_TRIGGER_OS resumes it in the next calls).
+ */
+static uint8_t KV_set_phase = KV_SET_IDLE;
+static uint8_t KV_set_key = KV_NO_KEY;
+static uint8_t KV_set_length = 0U;
+static uint8_t * KV_set_value = NULL_PTR;
+static uint8_t KV_set_slot = 0U;
+static uint16_t KV_set_address = 0U;
+static uint16_t KV_set_written = EEPROM_NO_DATA;
+
+/**
+ * @brief State of the running compaction.
+ */
+static uint8_t KV_compact_phase = KV_COMPACT_IDLE;
+static uint8_t KV_compact_slot = 0U;
+static uint16_t KV_compact_end = 0U;
+static uint16_t KV_compact_written = EEPROM_NO_DATA;
+static uint16_t KV_compact_length = 0U;
+static uint8_t KV_compact_buffer[KV_ENTRY_HEADER_SIZE + KV_MAX_VALUE_SIZE];
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to write successive bytes to EEPROM until all of them are written.
+ * @param address The start Address in EEPROM.
+ * @param data A pointer to the data.
+ * @param length The number of bytes.
+ * @note It is used by KV_init only, the other writes are resumed by their callers in TIME_TRIGGER_OS.
+ * @return The status of EEPROM (EEPROM_DATA_IS_WRITTEN or EEPROM_ADDRESS_NOT_AVAILABLE).
+ */
+static driver_status_t KV_write_bytes(uint16_t address, uint8_t * data, uint16_t length)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+    uint16_t actual_length = EEPROM_NO_DATA;
+    uint16_t programmed_length = EEPROM_NO_DATA;
+
+    /* In TIME_TRIGGER_OS, one byte is programmed per call */
+    do
+    {
+        KV_status = EEPROM_update_data(address, data, length, &actual_length, &programmed_length);
+    } while (KV_status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN);
+
+    return KV_status;
+}
+
+/**
+ * @brief This function is used to find the index entry of a key.
+ * @param key The key.
+ * @return The slot which holds the key, or the empty slot at which it can be added, or KV_INDEX_SIZE if the key
+ * is not found and the index is full.
+ */
+static uint8_t KV_lookup(uint8_t key)
+{
+    uint8_t slot = KV_HASH(key);
+    uint8_t probes = 0U;
+
+    /* Probe the next slots until the key or an empty slot is found */
+    while ((probes < KV_INDEX_SIZE) && (KV_index[slot].key != key) && (KV_index[slot].key != KV_NO_KEY))
+    {
+        slot = KV_NEXT_SLOT(slot);
+        probes++;
+    }
+
+    return (probes < KV_INDEX_SIZE) ? slot : (uint8_t)KV_INDEX_SIZE;
+}
+
+/**
+ * @brief This function is used to read the generation of a half.
+ * @param half The half (0 or 1).
+ * @param generation A pointer to the generation.
+ * @return SET_VALUE if the half header is valid, otherwise CLEAR_VALUE.
+ */
+static uint8_t KV_read_header(uint8_t half, uint8_t * generation)
+{
+    uint8_t header[KV_HEADER_SIZE] = {KV_END_OF_LOG, KV_END_OF_LOG};
+
+    (void)EEPROM_read_bytes(KV_HALF_ADDRESS(half), header, KV_HEADER_SIZE);
+    *generation = header[KV_HEADER_GENERATION];
+
+    return ((uint8_t)(header[KV_HEADER_GENERATION] ^ header[KV_HEADER_CHECK]) == KV_HEADER_CHECK_MASK) ? SET_VALUE : CLEAR_VALUE;
+}
+
+/**
+ * @brief This function is used to scan the log of the active half and rebuild the index.
+ * @note Only the key and length of each entry are read, and the scan stops at the end of the log, at an invalid
+ * entry or at the end of the half, so it reads KV_HALF_SIZE / 3 entries at most.
+ * @return The status of Key-Value Store (DRIVER_IS_OK or KV_KEYS_ARE_FULL if the log has more keys than the index).
+ */
+static driver_status_t KV_scan(void)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+    uint8_t entry[KV_ENTRY_HEADER_SIZE] = {KV_END_OF_LOG, KV_END_OF_LOG};
+    uint16_t address = (uint16_t)(KV_HALF_ADDRESS(KV_active_half) + KV_HEADER_SIZE);
+    uint8_t is_end = CLEAR_VALUE;
+    uint8_t slot = 0U;
+
+    while ((is_end == CLEAR_VALUE) && ((uint16_t)(address + KV_ENTRY_HEADER_SIZE) <= KV_HALF_END(KV_active_half)))
+    {
+        (void)EEPROM_read_bytes(address, entry, KV_ENTRY_HEADER_SIZE);
+
+        /* Check if that is the end of the log or an invalid entry */
+        if ((entry[KV_ENTRY_KEY] == KV_END_OF_LOG) || (entry[KV_ENTRY_LENGTH] == 0U) ||
+            (entry[KV_ENTRY_LENGTH] > KV_MAX_VALUE_SIZE) ||
+            ((uint16_t)(address + KV_ENTRY_SIZE(entry[KV_ENTRY_LENGTH])) > KV_HALF_END(KV_active_half)))
+        {
+            is_end = SET_VALUE;
+        }
+        else
+        {
+            slot = KV_lookup(entry[KV_ENTRY_KEY]);
+
+            /* Check if the index is full */
+            if (slot == KV_INDEX_SIZE)
+            {
+                KV_status = KV_KEYS_ARE_FULL;
+                is_end = SET_VALUE;
+            }
+            else
+            {
+                /* Check if that is a new key */
+                if (KV_index[slot].key == KV_NO_KEY)
+                {
+                    KV_index[slot].key = entry[KV_ENTRY_KEY];
+                    KV_stats.keys++;
+                }
+                else
+                {
+                    /* The older value is not live anymore */
+                    KV_stats.live_bytes = (uint16_t)(KV_stats.live_bytes - KV_ENTRY_SIZE(KV_index[slot].length));
+                }
+
+                /* The entry is the newest value of the key */
+                KV_index[slot].length = entry[KV_ENTRY_LENGTH];
+                KV_index[slot].address = address;
+                KV_stats.live_bytes = (uint16_t)(KV_stats.live_bytes + KV_ENTRY_SIZE(entry[KV_ENTRY_LENGTH]));
+                KV_stats.boot_entries++;
+
+                address = (uint16_t)(address + KV_ENTRY_SIZE(entry[KV_ENTRY_LENGTH]));
+            }
+        }
+    }
+
+    KV_log_end = address;
+
+    return KV_status;
+}
+
+/**
+ * @brief This function is used to run one step of the compaction which copies the newest values to the other half.
+ * @note A step copies one entry, or writes the end of the log, or writes the header which selects the other half.
+ * @note In TIME_TRIGGER_OS, at most one byte is programmed per step.
+ * @note The index is moved to the copied entries as they have the same values, and the active half is kept valid
+ * until the header of the other half is written.
+ * @return The status of Key-Value Store (EEPROM_DATA_IS_WRITTEN if the compaction is completed, otherwise
+ * EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+static driver_status_t KV_compact_step(void)
+{
+    driver_status_t KV_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+    uint16_t programmed_length = EEPROM_NO_DATA;
+    uint8_t new_half = KV_OTHER_HALF(KV_active_half);
+
+    /* Copy the newest value of the next key */
+    if (KV_compact_phase == KV_COMPACT_COPY)
+    {
+        /* Skip the empty slots */
+        while ((KV_compact_slot < KV_INDEX_SIZE) && (KV_index[KV_compact_slot].key == KV_NO_KEY))
+        {
+            KV_compact_slot++;
+        }
+
+        if (KV_compact_slot == KV_INDEX_SIZE)
+        {
+            KV_compact_phase = KV_COMPACT_END_OF_LOG;
+            KV_compact_written = EEPROM_NO_DATA;
+        }
+        else
+        {
+            /* Read the entry once */
+            if (KV_compact_length == 0U)
+            {
+                KV_compact_length = KV_ENTRY_SIZE(KV_index[KV_compact_slot].length);
+                KV_compact_written = EEPROM_NO_DATA;
+                (void)EEPROM_read_bytes(KV_index[KV_compact_slot].address, KV_compact_buffer, KV_compact_length);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* The other half is not valid yet, so the key can be written with the value */
+            if (EEPROM_update_data(KV_compact_end, KV_compact_buffer, KV_compact_length, &KV_compact_written,
+                                   &programmed_length) == EEPROM_DATA_IS_WRITTEN)
+            {
+                KV_index[KV_compact_slot].address = KV_compact_end;
+                KV_compact_end = (uint16_t)(KV_compact_end + KV_compact_length);
+                KV_compact_length = 0U;
+                KV_compact_slot++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+    /* Write the end of the log */
+    else if (KV_compact_phase == KV_COMPACT_END_OF_LOG)
+    {
+        KV_compact_buffer[KV_ENTRY_KEY] = KV_END_OF_LOG;
+        if ((KV_compact_end >= KV_HALF_END(new_half)) ||
+            (EEPROM_update_data(KV_compact_end, KV_compact_buffer, 1U, &KV_compact_written, &programmed_length) ==
+             EEPROM_DATA_IS_WRITTEN))
+        {
+            KV_compact_phase = KV_COMPACT_HEADER;
+            KV_compact_written = EEPROM_NO_DATA;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    /* Write the header which selects the other half */
+    else if (KV_compact_phase == KV_COMPACT_HEADER)
+    {
+        KV_compact_buffer[KV_HEADER_GENERATION] = (uint8_t)(KV_generation + 1U);
+        KV_compact_buffer[KV_HEADER_CHECK] = (uint8_t)(~(uint8_t)(KV_generation + 1U));
+        if (EEPROM_update_data(KV_HALF_ADDRESS(new_half), KV_compact_buffer, KV_HEADER_SIZE, &KV_compact_written,
+                               &programmed_length) == EEPROM_DATA_IS_WRITTEN)
+        {
+            /* The other half is the active one */
+            KV_active_half = new_half;
+            KV_generation++;
+            KV_log_end = KV_compact_end;
+            KV_compact_phase = KV_COMPACT_IDLE;
+            KV_stats.compactions++;
+            KV_status = EEPROM_DATA_IS_WRITTEN;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* No compaction is running */
+        KV_status = EEPROM_DATA_IS_WRITTEN;
+    }
+
+    return KV_status;
+}
+
+/**
+ * @brief This function is used to start a compaction.
+ */
+static void KV_compact_start(void)
+{
+    KV_compact_phase = KV_COMPACT_COPY;
+    KV_compact_slot = 0U;
+    KV_compact_length = 0U;
+    KV_compact_end = (uint16_t)(KV_HALF_ADDRESS(KV_OTHER_HALF(KV_active_half)) + KV_HEADER_SIZE);
+}
+
+/**
+ * @brief This function is used to run the running compaction.
+ * @note In SUPER_LOOP_OS, it waits until the compaction is completed.
+ * @note In TIME_TRIGGER_OS, it runs one step.
+ * @return The status of Key-Value Store (EEPROM_DATA_IS_WRITTEN or EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN).
+ */
+static driver_status_t KV_compact_run(void)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+
+/* Check which OS is used */
+#if OS == SUPER_LOOP_OS
+    do
+    {
+        KV_status = KV_compact_step();
+    } while (KV_status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN);
+#elif OS == TIME_TRIGGER_OS
+    KV_status = KV_compact_step();
+#endif
+
+    return KV_status;
+}
+
+/**
+ * @brief This function is used to start a set at the end of the log.
+ * @param key The key.
+ * @param value A pointer to the value.
+ * @param length The length of the value.
+ */
+static void KV_set_start(uint8_t key, uint8_t * value, uint8_t length)
+{
+    KV_set_phase = KV_SET_LENGTH;
+    KV_set_key = key;
+    KV_set_length = length;
+    KV_set_value = value;
+    KV_set_address = KV_log_end;
+    KV_set_written = EEPROM_NO_DATA;
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to open the key-value store, select its newest valid half and rebuild the RAM index.
+ * @note If no half is valid, the store is formatted (the first half gets an empty log).
+ * @note The rebuild reads the key and length of each log entry once, its time is reported in boot_ticks of KV_get_stats
+ * (the timebase must be started before KV_init).
+ * @return The status of Key-Value Store (DRIVER_IS_OK or KV_KEYS_ARE_FULL if the log has more keys than the index).
+ */
+driver_status_t KV_init(void)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+    uint8_t header[KV_HEADER_SIZE] = {0U, KV_HEADER_CHECK_MASK};
+    uint8_t generation[2] = {0U, 0U};
+    uint8_t is_valid[2] = {CLEAR_VALUE, CLEAR_VALUE};
+    uint32_t start = KV_GET_TICKS();
+    uint8_t slot = 0U;
+
+    /* Clear the index and the statistics */
+    for (slot = 0U; slot < KV_INDEX_SIZE; slot++)
+    {
+        KV_index[slot].key = KV_NO_KEY;
+    }
+    KV_stats.boot_entries = 0U;
+    KV_stats.keys = 0U;
+    KV_stats.live_bytes = 0U;
+    KV_stats.compactions = 0U;
+    KV_set_phase = KV_SET_IDLE;
+    KV_compact_phase = KV_COMPACT_IDLE;
+
+    /* Select the newest valid half */
+    is_valid[0] = KV_read_header(0U, &generation[0]);
+    is_valid[1] = KV_read_header(1U, &generation[1]);
+
+    if ((is_valid[0] == SET_VALUE) && (is_valid[1] == SET_VALUE))
+    {
+        KV_active_half = ((int8_t)(generation[1] - generation[0]) > 0) ? 1U : 0U;
+    }
+    else if (is_valid[0] == SET_VALUE)
+    {
+        KV_active_half = 0U;
+    }
+    else if (is_valid[1] == SET_VALUE)
+    {
+        KV_active_half = 1U;
+    }
+    else
+    {
+        /* Format the first half, the end of the log is written before the header */
+        KV_active_half = 0U;
+        generation[0] = 0U;
+        (void)KV_write_bytes((uint16_t)(KV_HALF_ADDRESS(0U) + KV_HEADER_SIZE), &header[KV_HEADER_CHECK], 1U);
+        (void)KV_write_bytes(KV_HALF_ADDRESS(0U), header, KV_HEADER_SIZE);
+    }
+    KV_generation = generation[KV_active_half];
+
+    /* Rebuild the index */
+    KV_status = KV_scan();
+
+    KV_stats.boot_ticks = KV_GET_TICKS() - start;
+
+    /* Return Key-Value Store status */
+    return KV_status;
+}
+
+/**
+ * @brief This API is used to get the value of a key.
+ * @param key The key (0 -> 254).
+ * @param value A pointer to the value.
+ * @param length A pointer to the size of value buffer, it is updated to the length of the value.
+ * @note The key is found in the RAM index, so only the value is read from EEPROM.
+ * @return The value and the status of Key-Value Store (EEPROM_DATA_IS_READ, KV_KEY_IS_NOT_FOUND,
+ * VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER if the buffer is too small or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t KV_get(uint8_t key, uint8_t * value, uint8_t * length)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+    uint8_t slot = 0U;
+
+    /* Check if the pointers are null pointers */
+    if ((value == NULL_PTR) || (length == NULL_PTR))
+    {
+        KV_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        slot = KV_lookup(key);
+
+        /* Check if the key is stored */
+        if ((key == KV_NO_KEY) || (slot == KV_INDEX_SIZE) || (KV_index[slot].key != key))
+        {
+            KV_status = KV_KEY_IS_NOT_FOUND;
+        }
+        /* Check if the value fits in the buffer */
+        else if (KV_index[slot].length > *length)
+        {
+            KV_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+        }
+        else
+        {
+            *length = KV_index[slot].length;
+            KV_status = EEPROM_read_bytes((uint16_t)(KV_index[slot].address + KV_ENTRY_HEADER_SIZE), value, *length);
+        }
+    }
+
+    /* Return Key-Value Store status */
+    return KV_status;
+}
+
+/**
+ * @brief This API is used to set the value of a key by appending it to the log.
+ * @param key The key (0 -> 254).
+ * @param value A pointer to the value, it must not be changed until the set is completed.
+ * @param length The length of the value (1 -> KV_MAX_VALUE_SIZE).
+ * @note Nothing is written if the key already has the same value.
+ * @note The key of the entry is written last, so an interrupted set keeps the previous value.
+ * @note If the active half is full, a compaction is run first (in TIME_TRIGGER_OS, one step per call).
+ * @note In TIME_TRIGGER_OS, it must be called again with the same arguments until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of Key-Value Store (EEPROM_DATA_IS_WRITTEN, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN, KV_KEYS_ARE_FULL,
+ * KV_LOG_IS_FULL, VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t KV_set(uint8_t key, uint8_t * value, uint8_t length)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+    uint16_t programmed_length = EEPROM_NO_DATA;
+    uint8_t stored[KV_MAX_VALUE_SIZE];
+    uint8_t index = 0U;
+
+    /* Check if the pointer is null pointer */
+    if (value == NULL_PTR)
+    {
+        KV_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the key and the length are accepted */
+    else if ((key == KV_NO_KEY) || (length == 0U) || (length > KV_MAX_VALUE_SIZE) || (KV_active_half == KV_NO_HALF))
+    {
+        KV_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    /* Check if a compaction is running */
+    else if (KV_compact_phase != KV_COMPACT_IDLE)
+    {
+        (void)KV_compact_run();
+        KV_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+    }
+    else
+    {
+        /* Check if that is a new set */
+        if (KV_set_phase == KV_SET_IDLE)
+        {
+            KV_set_slot = KV_lookup(key);
+            KV_status = EEPROM_DATA_IS_WRITTEN;
+
+            /* Check if the index is full */
+            if (KV_set_slot == KV_INDEX_SIZE)
+            {
+                KV_status = KV_KEYS_ARE_FULL;
+            }
+            else
+            {
+                /* Check if the key already has the same value */
+                if ((KV_index[KV_set_slot].key == key) && (KV_index[KV_set_slot].length == length))
+                {
+                    (void)EEPROM_read_bytes((uint16_t)(KV_index[KV_set_slot].address + KV_ENTRY_HEADER_SIZE), stored, length);
+                    index = 0U;
+                    while ((index < length) && (stored[index] == value[index]))
+                    {
+                        index++;
+                    }
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+
+                if (index < length)
+                {
+                    /* Check if the entry fits in the active half */
+                    if ((uint16_t)(KV_log_end + KV_ENTRY_SIZE(length)) <= KV_HALF_END(KV_active_half))
+                    {
+                        KV_set_start(key, value, length);
+                    }
+                    /* Check if the entry fits after a compaction (the compaction keeps the current value of the key) */
+                    else if ((uint16_t)(KV_HEADER_SIZE + KV_stats.live_bytes + KV_ENTRY_SIZE(length)) <= KV_HALF_SIZE)
+                    {
+                        KV_compact_start();
+
+                        /* In TIME_TRIGGER_OS, the set is started in the call after the compaction is completed */
+                        if (KV_compact_run() == EEPROM_DATA_IS_WRITTEN)
+                        {
+                            KV_set_start(key, value, length);
+                        }
+                        else
+                        {
+                            KV_status = EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN;
+                        }
+                    }
+                    else
+                    {
+                        KV_status = KV_LOG_IS_FULL;
+                    }
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the length */
+        if (KV_set_phase == KV_SET_LENGTH)
+        {
+            KV_status = EEPROM_update_data((uint16_t)(KV_set_address + KV_ENTRY_LENGTH), &KV_set_length, 1U,
+                                           &KV_set_written, &programmed_length);
+            if (KV_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                KV_set_phase = KV_SET_VALUE;
+                KV_set_written = EEPROM_NO_DATA;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the value */
+        if (KV_set_phase == KV_SET_VALUE)
+        {
+            KV_status = EEPROM_update_data((uint16_t)(KV_set_address + KV_ENTRY_HEADER_SIZE), KV_set_value, KV_set_length,
+                                           &KV_set_written, &programmed_length);
+            if (KV_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                KV_set_phase = KV_SET_END_OF_LOG;
+                KV_set_written = EEPROM_NO_DATA;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the end of the log after the entry, so a stale byte of the half is not read as an entry */
+        if (KV_set_phase == KV_SET_END_OF_LOG)
+        {
+            stored[KV_ENTRY_KEY] = KV_END_OF_LOG;
+            if ((uint16_t)(KV_set_address + KV_ENTRY_SIZE(KV_set_length)) >= KV_HALF_END(KV_active_half))
+            {
+                KV_status = EEPROM_DATA_IS_WRITTEN;
+            }
+            else
+            {
+                KV_status = EEPROM_update_data((uint16_t)(KV_set_address + KV_ENTRY_SIZE(KV_set_length)), stored, 1U,
+                                               &KV_set_written, &programmed_length);
+            }
+
+            if (KV_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                KV_set_phase = KV_SET_KEY;
+                KV_set_written = EEPROM_NO_DATA;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the key which commits the entry */
+        if (KV_set_phase == KV_SET_KEY)
+        {
+            KV_status = EEPROM_update_data(KV_set_address, &KV_set_key, 1U, &KV_set_written, &programmed_length);
+            if (KV_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                /* Check if that is a new key */
+                if (KV_index[KV_set_slot].key == KV_NO_KEY)
+                {
+                    KV_index[KV_set_slot].key = KV_set_key;
+                    KV_stats.keys++;
+                }
+                else
+                {
+                    KV_stats.live_bytes = (uint16_t)(KV_stats.live_bytes - KV_ENTRY_SIZE(KV_index[KV_set_slot].length));
+                }
+
+                /* The entry is the newest value of the key */
+                KV_index[KV_set_slot].length = KV_set_length;
+                KV_index[KV_set_slot].address = KV_set_address;
+                KV_stats.live_bytes = (uint16_t)(KV_stats.live_bytes + KV_ENTRY_SIZE(KV_set_length));
+                KV_log_end = (uint16_t)(KV_set_address + KV_ENTRY_SIZE(KV_set_length));
+                KV_set_phase = KV_SET_IDLE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    /* Return Key-Value Store status */
+    return KV_status;
+}
+
+/**
+ * @brief This API is used to compact the log in the background.
+ * @note A compaction is started if the free bytes of the active half are less than KV_COMPACT_THRESHOLD and the log
+ * holds older values, then it copies the newest values to the other half.
+ * @note In TIME_TRIGGER_OS, it runs one step per call (at most one programmed byte), so it can be a periodic task.
+ * @note In SUPER_LOOP_OS, it waits until the compaction is completed.
+ * @return The status of Key-Value Store (DRIVER_IS_OK if there is nothing to compact, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN
+ * while the compaction is running or EEPROM_DATA_IS_WRITTEN when it is completed).
+ */
+driver_status_t KV_compact(void)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+
+    /* Check if a compaction is needed and no set is running */
+    if ((KV_compact_phase == KV_COMPACT_IDLE) && (KV_set_phase == KV_SET_IDLE) && (KV_active_half != KV_NO_HALF) &&
+        ((uint16_t)(KV_HALF_END(KV_active_half) - KV_log_end) < KV_COMPACT_THRESHOLD) &&
+        ((uint16_t)(KV_HEADER_SIZE + KV_stats.live_bytes) < (uint16_t)(KV_log_end - KV_HALF_ADDRESS(KV_active_half))))
+    {
+        KV_compact_start();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Run the compaction */
+    if (KV_compact_phase != KV_COMPACT_IDLE)
+    {
+        KV_status = KV_compact_run();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Return Key-Value Store status */
+    return KV_status;
+}
+
+/**
+ * @brief This API is used to get the statistics of the store.
+ * @param stats A pointer to the statistics.
+ * @return The statistics and the status of Key-Value Store (DRIVER_IS_OK or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t KV_get_stats(kv_stats_t * stats)
+{
+    driver_status_t KV_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (stats == NULL_PTR)
+    {
+        KV_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        KV_stats.free_bytes = (KV_active_half != KV_NO_HALF) ? (uint16_t)(KV_HALF_END(KV_active_half) - KV_log_end) : 0U;
+        *stats = KV_stats;
+    }
+
+    /* Return Key-Value Store status */
+    return KV_status;
+}
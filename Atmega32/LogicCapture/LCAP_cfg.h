@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 13:31:24                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 13:31:24                              *
+ * @FilePath              : LCAP_cfg.h                                       *
+ ****************************************************************************/
+
+#ifndef LOGICCAPTURE_LCAP_CFG_H_
+#define LOGICCAPTURE_LCAP_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Sample Period in Timebase ticks
+ * @note Sample Rate = F_CPU / (Timebase Prescaler * LCAP_SAMPLE_PERIOD), e.g. 100 kHz at 8MHz with TB_PRESCALER_1.
+ * @note The period must be longer than the time needed to store one sample, otherwise LCAP_SAMPLE_RATE_MISSED is returned.
+ */
+
+#define LCAP_SAMPLE_PERIOD          80U
+
+/**
+ * @brief Capture Buffer Size in Run-Length entries (2 bytes per entry)
+ * @note Each entry holds one level of the port and the number of successive samples (up to 255) having that level.
+ */
+
+#define LCAP_BUFFER_ENTRIES         512U
+
+#endif
@@ -0,0 +1,39 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 13:30:51                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 13:30:51                              *
+ * @FilePath              : LCAP_int.h                                       *
+ ****************************************************************************/
+
+#ifndef LOGICCAPTURE_LCAP_INT_H_
+#define LOGICCAPTURE_LCAP_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+#include "../GPIO/GPIO_int.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Capture Output Function
+ * @note It is called by LCAP_dump for each byte of the capture (e.g. UART transmit function).
+ */
+typedef void (*lcap_output_t)(uint8_t byte);
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t LCAP_capture   (gpio_port_t port, uint8_t mask, uint32_t samples, uint16_t * entries);
+driver_status_t LCAP_get_entry (uint16_t index, uint8_t * value, uint8_t * run);
+driver_status_t LCAP_dump      (lcap_output_t output);
+
+#endif
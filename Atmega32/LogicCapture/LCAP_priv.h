@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 13:31:58                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:17:00                              *
+ * @FilePath              : LCAP_priv.h                                      *
+ ****************************************************************************/
+
+#ifndef LOGICCAPTURE_LCAP_PRIV_H_
+#define LOGICCAPTURE_LCAP_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Run-Length limits
+ */
+
+#define LCAP_FIRST_RUN                  1U
+#define LCAP_MAX_RUN                    255U
+#define LCAP_NO_ENTRIES                 0U
+#define LCAP_NO_SAMPLES                 0U
+
+/**
+ * @brief Timebase overflows which stay pending at the end of a capture (the overflow flag)
+ */
+
+#define LCAP_PENDING_OVERFLOWS          1U
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Run-Length Entry
+ */
+typedef struct
+{
+    uint8_t value;    /* Masked level of the port pins         */
+    uint8_t run;      /* Number of successive samples (1 -> 255) */
+}lcap_entry_t;
+
+#endif
@@ -0,0 +1,249 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 13:32:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:17:00                              *
+ * @FilePath              : LCAP_prog.c                                      *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "../GPIO/GPIO_int.h"
+#include "../Timebase/TB_int.h"
+#include "LCAP_int.h"
+#include "LCAP_priv.h"
+#include "LCAP_cfg.h"
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief GPIO Ports registers base addresses (same order as gpio_port_t, placed in flash).
+ */
+static const uint8_t LCAP_ports[PORT_MAX] FLASH_CONST =
+{
+    GPIO_A_BASE_ADDRESS,
+    GPIO_B_BASE_ADDRESS,
+    GPIO_C_BASE_ADDRESS,
+    GPIO_D_BASE_ADDRESS
+};
+
+/**
+ * @brief Capture Buffer and number of its used entries.
+ */
+static lcap_entry_t LCAP_buffer[LCAP_BUFFER_ENTRIES];
+static uint16_t LCAP_entries = LCAP_NO_ENTRIES;
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Access the registers of the Port at the given base address.
+ */
+#define LCAP_PORT_REGS(address)     IO_ACCESS((GPIO_Reg_S *) IO_ADDRESS((uintptr_t)(address)))
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to capture the levels of a port pins at a fixed sample rate into RAM.
+ * @param port The Port whose pins will be captured (PORT_A -> PORT_D).
+ * @param mask The captured pins (bit per pin), other pins are captured as low to improve the compression.
+ * @param samples The number of samples to be captured.
+ * @param entries A pointer to the number of Run-Length entries used by the capture.
+ * @note Samples are taken every LCAP_SAMPLE_PERIOD Timebase ticks, and only changes of the levels use new entries.
+ * @note The Timebase must be started by TB_init before the capture.
+ * @note Global Interrupt is disabled during the capture to keep the sample rate fixed, so the wraps of the Timebase
+ * are counted and the overflows which can not be served meanwhile are added to the Timebase before the end of the capture.
+ * It should be called with Global Interrupt enabled, so no Timebase overflow is pending before the capture.
+ * @return The number of used entries and the status of the capture (DRIVER_IS_OK, LCAP_BUFFER_IS_FULL,
+ * LCAP_SAMPLE_RATE_MISSED, VALUE_IS_NOT_EXISTED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t LCAP_capture(gpio_port_t port, uint8_t mask, uint32_t samples, uint16_t * entries)
+{
+    driver_status_t LCAP_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint8_t sample = CLEAR_VALUE;
+    uint16_t next_sample = 0U;
+    uint16_t ticks = 0U;
+    uint16_t last_ticks = 0U;
+    uint16_t wraps = 0U;
+    uint16_t entry = 0U;
+    uint32_t captured = LCAP_NO_SAMPLES;
+    uint8_t port_address = CLEAR_VALUE;
+
+    /* Check if the pointer is null pointer */
+    if (entries == NULL_PTR)
+    {
+        LCAP_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the Port is existed or not */
+    else if ((port >= PORT_MAX) || (samples == LCAP_NO_SAMPLES))
+    {
+        LCAP_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        /* Read the Port base address from flash before sampling */
+        port_address = FLASH_READ_BYTE(&LCAP_ports[port]);
+
+        /* Save Interrupts state and disable them */
+        ATOMIC_ENTER(sreg_state, ILT_LCAP_CAPTURE);
+
+        /* Take the first sample */
+        last_ticks = TB_get_ticks();
+        next_sample = (uint16_t)(last_ticks + LCAP_SAMPLE_PERIOD);
+        LCAP_buffer[entry].value = (uint8_t)(((LCAP_PORT_REGS(port_address)->PIN).reg) & mask);
+        LCAP_buffer[entry].run = LCAP_FIRST_RUN;
+        captured++;
+
+        while ((captured < samples) && (LCAP_status != LCAP_BUFFER_IS_FULL))
+        {
+            /* Count the wraps of the Timebase (it is read at least once per sample period) */
+            ticks = TB_get_ticks();
+            if (ticks < last_ticks)
+            {
+                wraps++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            last_ticks = ticks;
+
+            /* Check if the previous sample took more than the sample period */
+            if ((int16_t)(ticks - next_sample) > 0)
+            {
+                LCAP_status = LCAP_SAMPLE_RATE_MISSED;
+            }
+            else
+            {
+                /* Wait for the sample time */
+                while ((int16_t)(TB_get_ticks() - next_sample) < 0)
+                    ;
+            }
+            next_sample = (uint16_t)(next_sample + LCAP_SAMPLE_PERIOD);
+
+            /* Take the sample */
+            sample = (uint8_t)(((LCAP_PORT_REGS(port_address)->PIN).reg) & mask);
+            captured++;
+
+            /* Check if the level is not changed and the run can be extended */
+            if ((sample == LCAP_buffer[entry].value) && (LCAP_buffer[entry].run < LCAP_MAX_RUN))
+            {
+                LCAP_buffer[entry].run++;
+            }
+            /* Check if there is a free entry */
+            else if ((entry + 1U) < LCAP_BUFFER_ENTRIES)
+            {
+                entry++;
+                LCAP_buffer[entry].value = sample;
+                LCAP_buffer[entry].run = LCAP_FIRST_RUN;
+            }
+            else
+            {
+                /* Stop the capture, the last sample is not stored */
+                captured--;
+                LCAP_status = LCAP_BUFFER_IS_FULL;
+            }
+        }
+
+        /* Add the overflows which have not been counted (the last one is pending and counted by its interrupt) */
+        if (TB_get_ticks() < last_ticks)
+        {
+            wraps++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        if (wraps > LCAP_PENDING_OVERFLOWS)
+        {
+            (void)TB_add_overflows((uint16_t)(wraps - LCAP_PENDING_OVERFLOWS));
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_LCAP_CAPTURE);
+
+        /* Update the number of entries */
+        LCAP_entries = (uint16_t)(entry + 1U);
+        *entries = LCAP_entries;
+    }
+
+    /* Return capture status */
+    return LCAP_status;
+}
+
+/**
+ * @brief This API is used to get one Run-Length entry of the last capture.
+ * @param index The index of the entry (must be less than the number of entries of the capture).
+ * @param value A pointer to the masked level of the port pins.
+ * @param run A pointer to the number of successive samples having that level.
+ * @return The entry and the status of the capture (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t LCAP_get_entry(uint16_t index, uint8_t * value, uint8_t * run)
+{
+    driver_status_t LCAP_status = DRIVER_IS_OK;
+
+    /* Check if the pointers are null pointers */
+    if ((value == NULL_PTR) || (run == NULL_PTR))
+    {
+        LCAP_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the entry is existed or not */
+    else if (index >= LCAP_entries)
+    {
+        LCAP_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        *value = LCAP_buffer[index].value;
+        *run = LCAP_buffer[index].run;
+    }
+
+    /* Return capture status */
+    return LCAP_status;
+}
+
+/**
+ * @brief This API is used to dump the last capture as (value, run) byte pairs.
+ * @param output The function which sends each byte (e.g. UART transmit function).
+ * @return The status of the capture (DRIVER_IS_OK or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t LCAP_dump(lcap_output_t output)
+{
+    driver_status_t LCAP_status = DRIVER_IS_OK;
+    uint16_t index = 0U;
+
+    /* Check if the pointer is null pointer */
+    if (output == NULL_PTR)
+    {
+        LCAP_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Send all entries */
+        for (index = 0U; index < LCAP_entries; index++)
+        {
+            output(LCAP_buffer[index].value);
+            output(LCAP_buffer[index].run);
+        }
+    }
+
+    /* Return capture status */
+    return LCAP_status;
+}
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
+ * @CreatedDate           : 2026-10-17 14:41:12                              *
+ * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
+ * @LastEditDate          : 2026-10-18 03:08:00                              *
+ * @FilePath              : MM_cfg.h                                         *
+ ****************************************************************************/
+
+#ifndef MM_MM_CFG_H_
+#define MM_MM_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Wake-up Latency of each Sleep Mode in CPU cycles
+ * @note It is the time from the wake-up interrupt to the first instruction of its routine.
+ * @note Power-down and Power-save restart the main oscillator, so their latency is the start-up time selected by
+ * CKSEL/SUT fuses (e.g. 16K CK for crystal oscillator, 6 CK for calibrated internal RC oscillator).
+ * @note A Sleep Mode is selected by MM_idle only if its latency is less than the time to the next deadline.
+ */
+
+#define MM_PWR_DOWN_WAKEUP_CYCLES                   16384UL
+#define MM_PWR_SAVE_WAKEUP_CYCLES                   16384UL
+#define MM_STANDBY_WAKEUP_CYCLES                    10UL
+#define MM_EXTENDED_STANDBY_WAKEUP_CYCLES           10UL
+#define MM_ADC_NOISE_REDUCTION_WAKEUP_CYCLES        4UL
+#define MM_IDLE_WAKEUP_CYCLES                       4UL
+
+/**
+ * @brief Sleep Statistics Configuration
+ * @note Options are MM_STATS_DISABLE or MM_STATS_ENABLE
+ * @note If it is enabled, entries, residency and wake-up latency of each Sleep Mode are measured and read by MM_get_stats.
+ * @note It can be overridden from the compiler command line (-DMM_STATS=...), make test does it.
+ */
+
+#ifndef MM_STATS
+#define MM_STATS                    MM_STATS_DISABLE
+#endif
+
+/**
+ * @brief Sleep Statistics Timebase
+ * @note It must return uint32_t ticks of a free-running counter, differences are computed in uint32_t.
+ * @note TB_get_ticks32 extends Timer/Counter1 by its overflows count, so a sleep is measured up to 2^32 ticks.
+ * The Overflow Interrupt wakes the MCU from Idle Mode every 65536 ticks, each wake-up is counted as an entry.
+ * A 16-bit timebase must not be used, as sleeps longer than 65535 ticks would be recorded modulo 65536.
+ * @note Timer/Counter1 (TB_get_ticks32) is stopped in all Sleep Modes except Idle, so residency in deeper modes needs
+ * a timebase which keeps running in sleep (e.g. Timer/Counter2 from the asynchronous clock).
+ */
+
+#define MM_STATS_GET_TICKS()        TB_get_ticks32()
+
+#endif
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-08-07 22:36:20                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2023-08-07 23:05:59                              *
+ * @LastEditDate          : 2026-10-17 15:31:00                              *
  * @FilePath              : MM_int.h                                         *
  ****************************************************************************/
 
@@ -34,11 +34,52 @@ typedef enum
     LAST_MODE
 }mode_t;
 
+/**
+ * @brief Resources which can prevent deep Sleep Modes
+ * @note A resource is needed as long as it has users (MM_acquire / MM_release).
+ */
+typedef enum
+{
+    MM_IO_CLK_RESOURCE = (uint8_t)0 , /* I/O clock is needed (Timer/Counter0, Timer/Counter1, USART, SPI)         */
+    MM_ADC_RESOURCE                 , /* ADC conversion is in progress                                          */
+    MM_EEPROM_READY_RESOURCE        , /* EEPROM write is in progress and EEPROM Ready Interrupt must wake the MCU */
+    MM_ASYNC_TIMER_RESOURCE         , /* Timer/Counter2 is running from the asynchronous clock                  */
+    MM_MAX_RESOURCE
+}mm_resource_t;
+
+/**
+ * @brief Sleep Mode Statistics
+ * @note Residency and wake-up latency are measured in ticks of the configured statistics timebase (MM_STATS_GET_TICKS).
+ * @note Wake-up latency is measured from MM_mark_wakeup (called by the waking interrupt) to the instruction after sleep.
+ */
+typedef struct
+{
+    uint16_t entries;               /* Number of entries to the mode                              */
+    uint32_t residency_ticks;       /* Total time spent in the mode                               */
+    uint16_t last_wakeup_ticks;     /* Wake-up latency of the last exit from the mode             */
+    uint16_t max_wakeup_ticks;      /* Maximum measured wake-up latency                           */
+}mm_stats_t;
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief No Deadline value for MM_idle
+ */
+#define MM_NO_DEADLINE      0xFFFFFFFFUL
+
 /**
  * @section APIs
  */
 
 driver_status_t MM_set_mode   (mode_t mode);
+driver_status_t MM_set_mode_atomic(mode_t mode);
 driver_status_t MM_get_mode   (mode_t * mode);
+driver_status_t MM_acquire    (mm_resource_t resource);
+driver_status_t MM_release    (mm_resource_t resource);
+driver_status_t MM_idle       (uint32_t cycles_to_deadline, mode_t * mode);
+void            MM_mark_wakeup(void);
+driver_status_t MM_get_stats  (mode_t mode, mm_stats_t * stats);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
+ * @CreatedDate           : 2026-10-17 14:41:50                              *
+ * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
+ * @LastEditDate          : 2026-10-17 15:31:00                              *
+ * @FilePath              : MM_priv.h                                        *
+ ****************************************************************************/
+
+#ifndef MM_MM_PRIV_H_
+#define MM_MM_PRIV_H_
+
+/**
+ * @section Configuration Options
+ */
+
+/**
+ * @brief Sleep Statistics Options
+ */
+
+#define MM_STATS_DISABLE                0U
+#define MM_STATS_ENABLE                 1U
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Resources Masks (bit per resource in the same order as mm_resource_t)
+ */
+
+#define MM_NO_RESOURCES                 0x00U
+#define MM_RESOURCE_MASK(resource)      ((uint8_t)(SET_VALUE << (resource)))
+#define MM_ALL_RESOURCES                ((uint8_t)(MM_RESOURCE_MASK(MM_MAX_RESOURCE) - 1U))
+
+/**
+ * @brief Resources which are kept working in each Sleep Mode (Wake-up sources of Atmega32 Sleep Modes)
+ * @note EEPROM Ready and ADC Conversion Complete interrupts wake the MCU from Idle and ADC Noise Reduction only.
+ * @note Timer/Counter2 in asynchronous mode runs in all Sleep Modes except Power-down and Standby.
+ * @note I/O clock (Timer/Counter0, Timer/Counter1, USART and SPI) runs in Idle only.
+ */
+
+#define MM_PWR_DOWN_RESOURCES           MM_NO_RESOURCES
+#define MM_PWR_SAVE_RESOURCES           MM_RESOURCE_MASK(MM_ASYNC_TIMER_RESOURCE)
+#define MM_STANDBY_RESOURCES            MM_NO_RESOURCES
+#define MM_EXTENDED_STANDBY_RESOURCES   MM_RESOURCE_MASK(MM_ASYNC_TIMER_RESOURCE)
+#define MM_ADC_NOISE_REDUCTION_RESOURCES (MM_RESOURCE_MASK(MM_ADC_RESOURCE) | MM_RESOURCE_MASK(MM_EEPROM_READY_RESOURCE) | \
+                                          MM_RESOURCE_MASK(MM_ASYNC_TIMER_RESOURCE))
+#define MM_IDLE_RESOURCES               MM_ALL_RESOURCES
+
+/**
+ * @brief Resources Users values
+ */
+
+#define MM_NO_USERS                     0U
+#define MM_MAX_USERS                    0xFFU
+
+/**
+ * @brief Global Interrupt handling before the sleep instruction
+ */
+
+#define MM_KEEP_INTERRUPTS              0U
+#define MM_ENABLE_INTERRUPTS            1U
+
+/**
+ * @brief Number of Sleep Modes which can be selected by MM_idle
+ */
+
+#define MM_IDLE_MODES                   6U
+
+/**
+ * @brief Sleep Statistics values
+ */
+
+#define MM_SLEEP_MODES                  NORMAL_MODE
+#define MM_NOT_SLEEPING                 0U
+#define MM_IS_SLEEPING                  1U
+#define MM_WAKEUP_NOT_MARKED            0U
+#define MM_WAKEUP_IS_MARKED             1U
+
+
+/**
+ * @section Private Typedefs
+ */
+
+/**
+ * @brief Sleep Mode Policy Entry
+ */
+typedef struct
+{
+    mode_t   mode;                  /* Sleep Mode                                        */
+    uint8_t  resources;             /* Resources which are kept working in that mode     */
+    uint32_t wakeup_cycles;         /* Wake-up Latency in CPU cycles                     */
+}mm_policy_t;
+
+#endif
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-08-07 22:37:53                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2024-01-11 09:42:35                              *
+ * @LastEditDate          : 2026-10-18 03:08:00                              *
  * @FilePath              : MM_prog.c                                        *
  ****************************************************************************/
 
@@ -11,7 +11,14 @@
  */
 
 #include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
 #include "MM_int.h"
+#include "MM_priv.h"
+#include "MM_cfg.h"
+
+#if MM_STATS == MM_STATS_ENABLE
+#include "../Timebase/TB_int.h"
+#endif
 
 
 /**
@@ -20,11 +27,144 @@
 
 /**
  * @brief Sleep Macro
+ * @note On host (HOST_SIM build), the sleep instruction is replaced by the simulator sleep hook.
  */
+#if defined(HOST_SIM)
+#define sleep_cpu()         SIM_sleep()
+#else
 #define sleep_cpu()                              \
 do {                                             \
   __asm__ __volatile__ ( "sleep" "\n\t" :: );    \
 } while(0)
+#endif
+
+/**
+ * @brief Enable Global Interrupt then Sleep Macro
+ * @note The instruction after sei is always executed before any pending interrupt, so an interrupt which comes
+ * after the caller checks its wake-up condition can not be served before the sleep instruction (it wakes the MCU up).
+ */
+#if defined(HOST_SIM)
+#define sei_sleep_cpu()                                                     \
+do {                                                                        \
+  SIM_io_space[SREG_ADDRESS] |= (uint8_t)(SET_VALUE << BIT7);               \
+  SIM_sleep();                                                              \
+} while(0)
+#else
+#define sei_sleep_cpu()                                   \
+do {                                                      \
+  __asm__ __volatile__ ( "sei" "\n\t" "sleep" "\n\t" :: ); \
+} while(0)
+#endif
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Number of users of each resource (same order as mm_resource_t).
+ */
+static volatile uint8_t MM_resource_users[MM_MAX_RESOURCE];
+
+/**
+ * @brief Sleep Modes Policy Table, ordered from the lowest power consumption to the highest one.
+ */
+static const mm_policy_t MM_policy[MM_IDLE_MODES] =
+{
+    {PWR_DOWN_MODE,             MM_PWR_DOWN_RESOURCES,              MM_PWR_DOWN_WAKEUP_CYCLES},
+    {PWR_SAVE_MODE,             MM_PWR_SAVE_RESOURCES,              MM_PWR_SAVE_WAKEUP_CYCLES},
+    {STANDBY_MODE,              MM_STANDBY_RESOURCES,               MM_STANDBY_WAKEUP_CYCLES},
+    {EXTENDED_STANDBY_MODE,     MM_EXTENDED_STANDBY_RESOURCES,      MM_EXTENDED_STANDBY_WAKEUP_CYCLES},
+    {ADC_NOISE_REDUCTION_MODE,  MM_ADC_NOISE_REDUCTION_RESOURCES,   MM_ADC_NOISE_REDUCTION_WAKEUP_CYCLES},
+    {IDLE_MODE,                 MM_IDLE_RESOURCES,                  MM_IDLE_WAKEUP_CYCLES}
+};
+
+#if MM_STATS == MM_STATS_ENABLE
+/**
+ * @brief Sleep Statistics of each Sleep Mode (indexed by mode_t value).
+ */
+static mm_stats_t MM_stats[MM_SLEEP_MODES];
+
+/**
+ * @brief Current sleep state, entry time and wake-up time which is marked by the waking interrupt.
+ */
+static volatile uint8_t MM_sleep_state = MM_NOT_SLEEPING;
+static volatile uint8_t MM_wakeup_state = MM_WAKEUP_NOT_MARKED;
+static volatile uint32_t MM_wakeup_ticks = 0U;
+#endif
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to sleep in a Sleep Mode and update its statistics.
+ * @param mode The Sleep Mode (IDLE_MODE, ADC_NOISE_REDUCTION_MODE, PWR_DOWN_MODE, PWR_SAVE_MODE, STANDBY_MODE or
+ * EXTENDED_STANDBY_MODE).
+ * @param interrupts MM_ENABLE_INTERRUPTS to enable Global Interrupt right before the sleep instruction,
+ * or MM_KEEP_INTERRUPTS.
+ */
+static void MM_sleep(mode_t mode, uint8_t interrupts)
+{
+#if MM_STATS == MM_STATS_ENABLE
+    uint32_t entry_ticks = 0U;
+    uint32_t resume_ticks = 0U;
+#endif
+
+    /* Set Selected Sleep Mode */
+    ((MCUCR ->bits).SM) = (uint8_t)mode;
+
+    /* Enable Sleep Mode */
+    ((MCUCR -> bits).SE) = (uint8_t)SET_VALUE;
+
+#if MM_STATS == MM_STATS_ENABLE
+    /* Stamp the entry time */
+    MM_wakeup_state = MM_WAKEUP_NOT_MARKED;
+    entry_ticks = MM_STATS_GET_TICKS();
+    MM_sleep_state = MM_IS_SLEEPING;
+#endif
+
+    /* Run Sleep Instruction */
+    if(interrupts == MM_ENABLE_INTERRUPTS)
+    {
+        sei_sleep_cpu();
+    }
+    else
+    {
+        sleep_cpu();
+    }
+
+#if MM_STATS == MM_STATS_ENABLE
+    /* Stamp the resume time */
+    resume_ticks = MM_STATS_GET_TICKS();
+    MM_sleep_state = MM_NOT_SLEEPING;
+
+    /* Update the statistics of the mode */
+    MM_stats[mode].entries++;
+    if(MM_wakeup_state == MM_WAKEUP_IS_MARKED)
+    {
+        MM_stats[mode].residency_ticks += (MM_wakeup_ticks - entry_ticks);
+        MM_stats[mode].last_wakeup_ticks = (uint16_t)(resume_ticks - MM_wakeup_ticks);
+        if(MM_stats[mode].last_wakeup_ticks > MM_stats[mode].max_wakeup_ticks)
+        {
+            MM_stats[mode].max_wakeup_ticks = MM_stats[mode].last_wakeup_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Wake-up source did not mark the wake-up time */
+        MM_stats[mode].residency_ticks += (resume_ticks - entry_ticks);
+    }
+#endif
+
+    /* Disable Sleep Mode */
+    ((MCUCR -> bits).SE) = (uint8_t)CLEAR_VALUE;
+}
 
 
 /**
@@ -54,17 +194,40 @@ driver_status_t MM_set_mode(mode_t mode)
     }
     else
     {
-        /* Set Selected Sleep Mode */
-        ((MCUCR ->bits).SM) = (uint8_t)mode;
+        /* Sleep in the selected mode */
+        MM_sleep(mode, MM_KEEP_INTERRUPTS);
+    }
 
-        /* Enable Sleep Mode */
-        ((MCUCR -> bits).SE) = (uint8_t)SET_VALUE;
+    /* Return Mode Manager status */
+    return MM_status;
+}
 
-        /* Run Sleep Instruction */
-        sleep_cpu();
+/**
+ * @brief This API is used to sleep without losing the wake-up interrupt.
+ * @param mode The Sleep Mode (IDLE_MODE, ADC_NOISE_REDUCTION_MODE, PWR_DOWN_MODE, PWR_SAVE_MODE, STANDBY_MODE or
+ * EXTENDED_STANDBY_MODE).
+ * @note It must be called with Global Interrupt disabled after the wake-up condition has been checked, Global Interrupt
+ * is enabled right before the sleep instruction and stays enabled after returning.
+ * @return The status of Mode Manager (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER).
+ */
+driver_status_t MM_set_mode_atomic(mode_t mode)
+{
+    driver_status_t MM_status = DRIVER_IS_OK;
 
-        /* Disable Sleep Mode */
-        ((MCUCR -> bits).SE) = (uint8_t)CLEAR_VALUE;
+    /* Check if the mode is existed or not */
+    if(mode >= LAST_MODE)
+    {
+        MM_status = VALUE_IS_NOT_EXISTED;
+    }
+    /* Check if the mode is a sleep mode or not */
+    else if(mode == NORMAL_MODE)
+    {
+        MM_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    else
+    {
+        /* Enable Global Interrupt and sleep in the selected mode */
+        MM_sleep(mode, MM_ENABLE_INTERRUPTS);
     }
 
     /* Return Mode Manager status */
@@ -104,4 +267,220 @@ driver_status_t MM_get_mode(mode_t * mode)
 
     /* Return Mode Manager status */
     return MM_status;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief This API is used to register a user of a resource, so MM_idle does not select Sleep Modes which stop it.
+ * @param resource The needed resource (MM_IO_CLK_RESOURCE -> MM_ASYNC_TIMER_RESOURCE).
+ * @note It can be called from Interrupt Service Routines.
+ * @return The status of Mode Manager (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER).
+ */
+driver_status_t MM_acquire(mm_resource_t resource)
+{
+    driver_status_t MM_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if the resource is existed or not */
+    if(resource >= MM_MAX_RESOURCE)
+    {
+        MM_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        /* Save Interrupts state and disable them while the users are updated */
+        ATOMIC_ENTER(sreg_state, ILT_MM_ACQUIRE);
+
+        /* Check if there is a room for a new user */
+        if(MM_resource_users[resource] < MM_MAX_USERS)
+        {
+            MM_resource_users[resource]++;
+        }
+        else
+        {
+            MM_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_MM_ACQUIRE);
+    }
+
+    /* Return Mode Manager status */
+    return MM_status;
+}
+
+/**
+ * @brief This API is used to unregister a user of a resource.
+ * @param resource The resource which is not needed anymore (MM_IO_CLK_RESOURCE -> MM_ASYNC_TIMER_RESOURCE).
+ * @note It can be called from Interrupt Service Routines.
+ * @return The status of Mode Manager (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER).
+ */
+driver_status_t MM_release(mm_resource_t resource)
+{
+    driver_status_t MM_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if the resource is existed or not */
+    if(resource >= MM_MAX_RESOURCE)
+    {
+        MM_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        /* Save Interrupts state and disable them while the users are updated */
+        ATOMIC_ENTER(sreg_state, ILT_MM_RELEASE);
+
+        /* Check if the resource has users */
+        if(MM_resource_users[resource] > MM_NO_USERS)
+        {
+            MM_resource_users[resource]--;
+        }
+        else
+        {
+            MM_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+        }
+
+        /* Restore Interrupts state */
+        ATOMIC_EXIT(sreg_state, ILT_MM_RELEASE);
+    }
+
+    /* Return Mode Manager status */
+    return MM_status;
+}
+
+/**
+ * @brief This API is used to sleep in the lowest power Sleep Mode which keeps the needed resources working and
+ * wakes up before the next deadline.
+ * @param cycles_to_deadline The CPU cycles until the next deadline (MM_NO_DEADLINE if there is no deadline).
+ * @param mode A pointer to the selected mode (NORMAL_MODE if the deadline is too close to sleep).
+ * @note The wake-up source of the deadline (e.g. Timer/Counter2 or the scheduler tick) must be registered by MM_acquire.
+ * @note It must be called with Global Interrupt disabled after the caller has checked its pending work and computed the
+ * deadline, so an interrupt which comes meanwhile (e.g. a released task or an MM_acquire) wakes the MCU up instead of
+ * being lost. The resources are collected under that lock, and Global Interrupt is enabled right before the sleep
+ * instruction (or before returning if the deadline is too close to sleep), so it is enabled after returning.
+ * @return The selected mode and the status of Mode Manager (DRIVER_IS_OK, PTR_USED_IS_NULL_PTR or
+ * VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS).
+ */
+driver_status_t MM_idle(uint32_t cycles_to_deadline, mode_t * mode)
+{
+    driver_status_t MM_status = DRIVER_IS_OK;
+    uint8_t needed_resources = MM_NO_RESOURCES;
+    uint8_t resource = 0U;
+    uint8_t index = 0U;
+
+    /* Check if the pointer is null Pointer */
+    if(mode == NULL_PTR)
+    {
+        MM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if Global Interrupt is disabled by the caller */
+    else if(((SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE)
+    {
+        MM_status = VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS;
+    }
+    else
+    {
+        /* Collect the needed resources */
+        for(resource = 0U; resource < MM_MAX_RESOURCE; resource++)
+        {
+            if(MM_resource_users[resource] != MM_NO_USERS)
+            {
+                needed_resources |= MM_RESOURCE_MASK(resource);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        /* Find the lowest power mode which keeps the needed resources and wakes up in time */
+        while((index < MM_IDLE_MODES) &&
+              (((MM_policy[index].resources & needed_resources) != needed_resources) ||
+               (MM_policy[index].wakeup_cycles >= cycles_to_deadline)))
+        {
+            index++;
+        }
+
+        /* Close the window which has been opened by the caller */
+        IRQ_LATENCY_STOP(ILT_MM_IDLE);
+
+        /* Check if there is a mode which can be used */
+        if(index < MM_IDLE_MODES)
+        {
+            /* Enable Global Interrupt and sleep in the selected mode */
+            *mode = MM_policy[index].mode;
+            MM_status = MM_set_mode_atomic(MM_policy[index].mode);
+        }
+        else
+        {
+            /* The deadline is too close to sleep */
+            *mode = NORMAL_MODE;
+            ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+        }
+    }
+
+    /* Return Mode Manager status */
+    return MM_status;
+}
+
+/**
+ * @brief This API is used to stamp the wake-up time, it must be called first by the Interrupt Service Routines which
+ * can wake up the MCU.
+ * @note It does nothing if the MCU is not sleeping by MM_set_mode or if Sleep Statistics are disabled.
+ */
+void MM_mark_wakeup(void)
+{
+#if MM_STATS == MM_STATS_ENABLE
+    /* Check if that is the first interrupt since sleep */
+    if((MM_sleep_state == MM_IS_SLEEPING) && (MM_wakeup_state == MM_WAKEUP_NOT_MARKED))
+    {
+        MM_wakeup_ticks = MM_STATS_GET_TICKS();
+        MM_wakeup_state = MM_WAKEUP_IS_MARKED;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+}
+
+/**
+ * @brief This API is used to get the Sleep Statistics of a Sleep Mode.
+ * @param mode The Sleep Mode (IDLE_MODE, ADC_NOISE_REDUCTION_MODE, PWR_DOWN_MODE, PWR_SAVE_MODE, STANDBY_MODE or
+ * EXTENDED_STANDBY_MODE).
+ * @param stats A pointer to the statistics of the mode.
+ * @return The statistics and the status of Mode Manager (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED, PTR_USED_IS_NULL_PTR or
+ * VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS if Sleep Statistics are disabled).
+ */
+driver_status_t MM_get_stats(mode_t mode, mm_stats_t * stats)
+{
+    driver_status_t MM_status = DRIVER_IS_OK;
+#if MM_STATS == MM_STATS_ENABLE
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    /* Check if the pointer is null Pointer */
+    if(stats == NULL_PTR)
+    {
+        MM_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the mode is a sleep mode or not */
+    else if(mode >= MM_SLEEP_MODES)
+    {
+        MM_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        /* Copy the statistics without interruption */
+        ATOMIC_ENTER(sreg_state, ILT_MM_GET_STATS);
+        *stats = MM_stats[mode];
+        ATOMIC_EXIT(sreg_state, ILT_MM_GET_STATS);
+    }
+#else
+    /* Sleep Statistics are not measured */
+    (void)mode;
+    (void)stats;
+    MM_status = VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS;
+#endif
+
+    /* Return Mode Manager status */
+    return MM_status;
+}
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 15:48:26                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 15:48:26                              *
+ * @FilePath              : REC_int.h                                        *
+ ****************************************************************************/
+
+#ifndef RECORDSTORE_REC_INT_H_
+#define RECORDSTORE_REC_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Record Store Handle
+ * @note The region is divided into slots, each slot holds one record followed by its 16-bit sequence number.
+ * @note Records are written to the slots in rotation, so all slots wear evenly.
+ * @note Members are managed by the Record Store APIs and must not be changed by the caller.
+ */
+typedef struct
+{
+    uint16_t  base_address;         /* The start Address of the region in EEPROM                        */
+    uint16_t  slots;                /* Number of slots in the region                                    */
+    uint8_t   record_size;          /* Size of one record in bytes                                      */
+    uint8_t   is_empty;             /* Set if there is no stored record                                 */
+    uint16_t  newest_slot;          /* Slot of the newest record                                        */
+    uint16_t  newest_sequence;      /* Sequence number of the newest record                             */
+    uint8_t   write_phase;          /* Phase of the running write (record then sequence number)         */
+    uint8_t * write_data;           /* Record of the running write                                      */
+    uint16_t  write_length;         /* Bytes which have been stored in the running phase                */
+    uint8_t   write_sequence[2];    /* Sequence number of the running write (Low byte, High byte)       */
+    uint32_t  programmed_bytes;     /* Number of programmed EEPROM bytes since initialization           */
+}rec_store_t;
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t REC_init   (rec_store_t * store, uint16_t base_address, uint16_t region_length, uint8_t record_size);
+driver_status_t REC_format (rec_store_t * store);
+driver_status_t REC_read   (rec_store_t * store, uint8_t * record);
+driver_status_t REC_write  (rec_store_t * store, uint8_t * record);
+
+#endif
@@ -0,0 +1,60 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 15:49:02                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 15:49:02                              *
+ * @FilePath              : REC_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef RECORDSTORE_REC_PRIV_H_
+#define RECORDSTORE_REC_PRIV_H_
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Sequence Numbers
+ * @note Sequence numbers are counted modulo REC_SEQUENCE_MODULO (0 -> 0xFFFE), 0xFFFF is the erased value.
+ */
+
+#define REC_SEQUENCE_SIZE               2U
+#define REC_SEQUENCE_MODULO             0xFFFFUL
+#define REC_BLANK_SEQUENCE              0xFFFFU
+#define REC_FIRST_SEQUENCE              0U
+#define REC_SEQUENCE_LOW_BYTE           0U
+#define REC_SEQUENCE_HIGH_BYTE          1U
+#define REC_SEQUENCE_MOST_BYTE          8U
+#define REC_ERASED_BYTE                 0xFFU
+
+/**
+ * @brief Region limits
+ */
+
+#define REC_MIN_SLOTS                   2U
+#define REC_MIN_RECORD_SIZE             1U
+
+/**
+ * @brief Write Phases
+ */
+
+#define REC_WRITE_IDLE                  0U
+#define REC_WRITE_RECORD                1U
+#define REC_WRITE_SEQUENCE              2U
+
+/**
+ * @brief Store States
+ */
+
+#define REC_HAS_RECORDS                 0U
+#define REC_IS_EMPTY                    1U
+
+/**
+ * @brief Slot Address in EEPROM
+ */
+
+#define REC_SLOT_SIZE(store)            ((uint16_t)((store)->record_size + REC_SEQUENCE_SIZE))
+#define REC_SLOT_ADDRESS(store, slot)   ((uint16_t)((store)->base_address + ((slot) * REC_SLOT_SIZE(store))))
+#define REC_SEQUENCE_ADDRESS(store, slot) ((uint16_t)(REC_SLOT_ADDRESS(store, slot) + (store)->record_size))
+
+#endif
@@ -0,0 +1,381 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 15:49:40                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:01:00                              *
+ * @FilePath              : REC_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../EEPROM/EEPROM_int.h"
+#include "../EEPROM/EEPROM_priv.h"
+#include "REC_int.h"
+#include "REC_priv.h"
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to read the sequence number of a slot.
+ * @param store A pointer to the store.
+ * @param slot The slot index.
+ * @return The sequence number (REC_BLANK_SEQUENCE for erased slots).
+ */
+static uint16_t REC_read_sequence(rec_store_t * store, uint16_t slot)
+{
+    uint8_t sequence[REC_SEQUENCE_SIZE] = {REC_ERASED_BYTE, REC_ERASED_BYTE};
+
+    (void)EEPROM_read_bytes(REC_SEQUENCE_ADDRESS(store, slot), sequence, REC_SEQUENCE_SIZE);
+
+    return (uint16_t)(((uint16_t)sequence[REC_SEQUENCE_HIGH_BYTE] << REC_SEQUENCE_MOST_BYTE) | sequence[REC_SEQUENCE_LOW_BYTE]);
+}
+
+/**
+ * @brief This function is used to get the sequence number which follows a sequence number.
+ * @param sequence The sequence number (0 -> 0xFFFE).
+ * @return The next sequence number (0 -> 0xFFFE).
+ */
+static uint16_t REC_next_sequence(uint16_t sequence)
+{
+    return (uint16_t)(((uint32_t)sequence + 1U) % REC_SEQUENCE_MODULO);
+}
+
+/**
+ * @brief This function is used to check if a slot has been written after slot 0 in the current rotation.
+ * @param store A pointer to the store.
+ * @param first_sequence The sequence number of slot 0.
+ * @param slot The slot index.
+ * @note It is true for slots 0 -> newest slot and false for the other slots (older rotation, erased or interrupted
+ * writes), so the newest slot is found by binary search.
+ * @return SET_VALUE if (sequence[slot] - sequence[0]) mod 0xFFFF == slot, otherwise CLEAR_VALUE.
+ */
+static uint8_t REC_is_current(rec_store_t * store, uint16_t first_sequence, uint16_t slot)
+{
+    uint16_t sequence = REC_read_sequence(store, slot);
+    uint8_t is_current = CLEAR_VALUE;
+
+    /* Check if the slot is written and its distance from slot 0 is its index */
+    if ((sequence != REC_BLANK_SEQUENCE) &&
+        (((((uint32_t)sequence + REC_SEQUENCE_MODULO) - first_sequence) % REC_SEQUENCE_MODULO) == slot))
+    {
+        is_current = SET_VALUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return is_current;
+}
+
+/**
+ * @brief This function is used to find the newest record of the store.
+ * @param store A pointer to the store.
+ * @note It reads O(log2(slots)) sequence numbers.
+ * @note A slot whose write was interrupted before its sequence number was completely written is not found, so the
+ * previous record is the newest one and that slot is written again by the next write.
+ */
+static void REC_find_newest(rec_store_t * store)
+{
+    uint16_t first_sequence = REC_read_sequence(store, 0U);
+    uint16_t last_sequence = REC_BLANK_SEQUENCE;
+    uint16_t low = 0U;
+    uint16_t high = (uint16_t)(store->slots - 1U);
+    uint16_t middle = 0U;
+
+    store->is_empty = REC_HAS_RECORDS;
+
+    /* Check if the store has never been written */
+    if (first_sequence == REC_BLANK_SEQUENCE)
+    {
+        store->is_empty = REC_IS_EMPTY;
+    }
+    else
+    {
+        /* Find the last slot of the current rotation */
+        while (low < high)
+        {
+            middle = (uint16_t)(low + ((uint16_t)(high - low + 1U) / 2U));
+            if (REC_is_current(store, first_sequence, middle) == SET_VALUE)
+            {
+                low = middle;
+            }
+            else
+            {
+                high = (uint16_t)(middle - 1U);
+            }
+        }
+
+        store->newest_slot = low;
+        store->newest_sequence = REC_read_sequence(store, low);
+
+        /* Slot 0 is the newest one, so check that its write has been completed */
+        if (low == 0U)
+        {
+            last_sequence = REC_read_sequence(store, (uint16_t)(store->slots - 1U));
+
+            /* Check if that is the first rotation */
+            if (last_sequence == REC_BLANK_SEQUENCE)
+            {
+                if (first_sequence != REC_FIRST_SEQUENCE)
+                {
+                    /* The first write has been interrupted */
+                    store->is_empty = REC_IS_EMPTY;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+            else if (first_sequence != REC_next_sequence(last_sequence))
+            {
+                /* The write of slot 0 has been interrupted, the last slot holds the newest record */
+                store->newest_slot = (uint16_t)(store->slots - 1U);
+                store->newest_sequence = last_sequence;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to open a record store over an EEPROM region and find its newest record.
+ * @param store A pointer to the store handle which is owned by the caller.
+ * @param base_address The start Address of the region in EEPROM.
+ * @param region_length The length of the region in bytes (it holds region_length / (record_size + 2) slots).
+ * @param record_size The size of one record in bytes.
+ * @note The region must hold 2 slots at least, and it must be formatted by REC_format before its first use.
+ * @return The status of Record Store (DRIVER_IS_OK, EEPROM_ADDRESS_NOT_AVAILABLE, VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER
+ * or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t REC_init(rec_store_t * store, uint16_t base_address, uint16_t region_length, uint8_t record_size)
+{
+    driver_status_t REC_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (store == NULL_PTR)
+    {
+        REC_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the region is in available EEPROM Space */
+    else if ((base_address > EEPROM_LAST_LOCATION) || (region_length == EEPROM_NO_DATA) ||
+             ((region_length - 1U) > (EEPROM_LAST_LOCATION - base_address)))
+    {
+        REC_status = EEPROM_ADDRESS_NOT_AVAILABLE;
+    }
+    /* Check if the region holds enough slots */
+    else if ((record_size < REC_MIN_RECORD_SIZE) ||
+             ((region_length / (uint16_t)(record_size + REC_SEQUENCE_SIZE)) < REC_MIN_SLOTS))
+    {
+        REC_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    else
+    {
+        /* Set the store layout */
+        store->base_address = base_address;
+        store->record_size = record_size;
+        store->slots = (uint16_t)(region_length / REC_SLOT_SIZE(store));
+        store->write_phase = REC_WRITE_IDLE;
+        store->programmed_bytes = 0U;
+
+        /* Find the newest record */
+        REC_find_newest(store);
+    }
+
+    /* Return Record Store status */
+    return REC_status;
+}
+
+/**
+ * @brief This API is used to erase all records of the store.
+ * @param store A pointer to the store (opened by REC_init).
+ * @note Only the sequence numbers are erased, records are kept as they are.
+ * @return The status of Record Store (EEPROM_DATA_IS_WRITTEN, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t REC_format(rec_store_t * store)
+{
+    driver_status_t REC_status = DRIVER_IS_OK;
+    uint8_t blank[REC_SEQUENCE_SIZE] = {REC_ERASED_BYTE, REC_ERASED_BYTE};
+    uint16_t slot = 0U;
+    uint16_t actual_length = EEPROM_NO_DATA;
+    uint16_t programmed_length = EEPROM_NO_DATA;
+
+    /* Check if the pointer is null pointer */
+    if (store == NULL_PTR)
+    {
+        REC_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        REC_status = EEPROM_DATA_IS_WRITTEN;
+
+        /* Erase the sequence numbers from the last slot to slot 0, so slot 0 still refers to consistent slots if the format is interrupted */
+        for (slot = store->slots; slot > 0U; slot--)
+        {
+            actual_length = EEPROM_NO_DATA;
+            programmed_length = EEPROM_NO_DATA;
+
+            /* In TIME_TRIGGER_OS, one byte is programmed per call */
+            do
+            {
+                REC_status = EEPROM_update_data(REC_SEQUENCE_ADDRESS(store, slot - 1U), blank, REC_SEQUENCE_SIZE,
+                                                &actual_length, &programmed_length);
+            } while (REC_status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN);
+
+            store->programmed_bytes += programmed_length;
+        }
+
+        store->is_empty = REC_IS_EMPTY;
+        store->write_phase = REC_WRITE_IDLE;
+    }
+
+    /* Return Record Store status */
+    return REC_status;
+}
+
+/**
+ * @brief This API is used to read the newest record of the store.
+ * @param store A pointer to the store (opened by REC_init).
+ * @param record A pointer to the record (record_size bytes).
+ * @return The record and the status of Record Store (EEPROM_DATA_IS_READ, REC_NO_RECORD_IS_STORED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t REC_read(rec_store_t * store, uint8_t * record)
+{
+    driver_status_t REC_status = DRIVER_IS_OK;
+
+    /* Check if the pointers are null pointers */
+    if ((store == NULL_PTR) || (record == NULL_PTR))
+    {
+        REC_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if there is a stored record */
+    else if (store->is_empty == REC_IS_EMPTY)
+    {
+        REC_status = REC_NO_RECORD_IS_STORED;
+    }
+    else
+    {
+        REC_status = EEPROM_read_bytes(REC_SLOT_ADDRESS(store, store->newest_slot), record, store->record_size);
+    }
+
+    /* Return Record Store status */
+    return REC_status;
+}
+
+/**
+ * @brief This API is used to store a new record in the slot after the newest one.
+ * @param store A pointer to the store (opened by REC_init).
+ * @param record A pointer to the record (record_size bytes), it must not be changed until the write is completed.
+ * @note The record is written first then its sequence number, so an interrupted write never hides the previous record.
+ * @note Only the bytes which differ from the overwritten slot are programmed.
+ * @note In TIME_TRIGGER_OS, it must be called again with the same record until EEPROM_DATA_IS_WRITTEN is returned.
+ * @return The status of Record Store (EEPROM_DATA_IS_WRITTEN, EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t REC_write(rec_store_t * store, uint8_t * record)
+{
+    driver_status_t REC_status = DRIVER_IS_OK;
+    uint16_t record_programmed = EEPROM_NO_DATA;
+    uint16_t sequence_programmed = EEPROM_NO_DATA;
+    uint16_t slot = 0U;
+    uint16_t sequence = REC_FIRST_SEQUENCE;
+
+    /* Check if the pointers are null pointers */
+    if ((store == NULL_PTR) || (record == NULL_PTR))
+    {
+        REC_status = PTR_USED_IS_NULL_PTR;
+    }
+    else
+    {
+        /* Get the slot and the sequence number of the new record */
+        if (store->is_empty == REC_IS_EMPTY)
+        {
+            slot = 0U;
+            sequence = REC_FIRST_SEQUENCE;
+        }
+        else
+        {
+            slot = (uint16_t)((store->newest_slot + 1U) % store->slots);
+            sequence = REC_next_sequence(store->newest_sequence);
+        }
+
+        /* Check if that is a new write */
+        if (store->write_phase == REC_WRITE_IDLE)
+        {
+            store->write_phase = REC_WRITE_RECORD;
+            store->write_data = record;
+            store->write_length = EEPROM_NO_DATA;
+            store->write_sequence[REC_SEQUENCE_LOW_BYTE] = (uint8_t)sequence;
+            store->write_sequence[REC_SEQUENCE_HIGH_BYTE] = (uint8_t)(sequence >> REC_SEQUENCE_MOST_BYTE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the record */
+        if (store->write_phase == REC_WRITE_RECORD)
+        {
+            REC_status = EEPROM_update_data(REC_SLOT_ADDRESS(store, slot), store->write_data, store->record_size,
+                                            &(store->write_length), &record_programmed);
+            if (REC_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                store->write_phase = REC_WRITE_SEQUENCE;
+                store->write_length = EEPROM_NO_DATA;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Write the sequence number which commits the record */
+        if (store->write_phase == REC_WRITE_SEQUENCE)
+        {
+            REC_status = EEPROM_update_data(REC_SEQUENCE_ADDRESS(store, slot), store->write_sequence, REC_SEQUENCE_SIZE,
+                                            &(store->write_length), &sequence_programmed);
+            if (REC_status == EEPROM_DATA_IS_WRITTEN)
+            {
+                /* The new record is the newest one */
+                store->write_phase = REC_WRITE_IDLE;
+                store->newest_slot = slot;
+                store->newest_sequence = sequence;
+                store->is_empty = REC_HAS_RECORDS;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Each phase has its own counter, since EEPROM_update_data resets it at the start of the phase */
+        store->programmed_bytes += (uint32_t)record_programmed + (uint32_t)sequence_programmed;
+    }
+
+    /* Return Record Store status */
+    return REC_status;
+}
@@ -0,0 +1,37 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 14:22:10                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 14:22:10                              *
+ * @FilePath              : SCH_cfg.h                                        *
+ ****************************************************************************/
+
+#ifndef SCHEDULER_SCH_CFG_H_
+#define SCHEDULER_SCH_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Maximum Number of Tasks
+ * @note The tasks table is allocated statically, so each task costs RAM even if it is not added.
+ */
+
+#define SCH_MAX_TASKS               4U
+
+/**
+ * @brief Tick Prescaler Configuration (Timer/Counter0)
+ * @note Options are SCH_PRESCALER_1, SCH_PRESCALER_8, SCH_PRESCALER_64, SCH_PRESCALER_256 or SCH_PRESCALER_1024
+ */
+
+#define SCH_TICK_PRESCALER          SCH_PRESCALER_64
+
+/**
+ * @brief Tick Compare Value (Timer/Counter0 in CTC Mode)
+ * @note Tick Period = (SCH_TICK_COMPARE + 1) * Prescaler CPU cycles, e.g. 1 ms at 8MHz with SCH_PRESCALER_64 and 124.
+ */
+
+#define SCH_TICK_COMPARE            124U
+
+#endif
@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 14:21:37                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 20:20:00                              *
+ * @FilePath              : SCH_int.h                                        *
+ ****************************************************************************/
+
+#ifndef SCHEDULER_SCH_INT_H_
+#define SCHEDULER_SCH_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Scheduler Task
+ * @note A task must run to completion and must not block (e.g. it calls one step of the TIME_TRIGGER_OS driver paths).
+ */
+typedef void (*sch_task_t)(void);
+
+/**
+ * @brief Scheduler Task Statistics
+ * @note Execution times are measured in extended Timebase ticks (TB_get_ticks32), so they do not wrap after 65535 ticks.
+ * @note The time of the interrupts which are served while the task runs is included in its execution time.
+ */
+typedef struct
+{
+    uint32_t last_ticks;        /* Execution time of the last run                          */
+    uint32_t wcet_ticks;        /* Worst-case (maximum) measured execution time            */
+    uint16_t budget_ticks;      /* Execution budget of the task (0 means no budget)        */
+    uint16_t runs;              /* Number of runs                                          */
+    uint16_t overruns;          /* Number of runs which exceeded the budget                */
+    uint16_t missed_slots;      /* Number of releases which were not served in their slot  */
+}sch_task_stats_t;
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t SCH_init           (void);
+driver_status_t SCH_add_task       (sch_task_t task, uint16_t period, uint16_t offset, uint16_t budget, uint8_t * task_id);
+driver_status_t SCH_start          (void);
+driver_status_t SCH_dispatch       (void);
+driver_status_t SCH_get_task_stats (uint8_t task_id, sch_task_stats_t * stats);
+
+#endif
@@ -0,0 +1,64 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 14:22:43                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 14:22:43                              *
+ * @FilePath              : SCH_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef SCHEDULER_SCH_PRIV_H_
+#define SCHEDULER_SCH_PRIV_H_
+
+/**
+ * @section Configuration Options
+ */
+
+/**
+ * @brief Tick Prescaler Options (Timer/Counter0 Clock Select values)
+ */
+
+#define SCH_PRESCALER_1                 1U
+#define SCH_PRESCALER_8                 2U
+#define SCH_PRESCALER_64                3U
+#define SCH_PRESCALER_256               4U
+#define SCH_PRESCALER_1024              5U
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Timer/Counter0 Modes
+ */
+
+#define SCH_TIMER_STOPPED               0U
+#define SCH_CTC_MODE                    1U
+
+/**
+ * @brief Tasks values
+ */
+
+#define SCH_NO_RELEASES                 0U
+#define SCH_MAX_RELEASES                0xFFU
+#define SCH_NO_BUDGET                   0U
+#define SCH_NO_PERIOD                   0U
+
+
+/**
+ * @section Private Typedefs
+ */
+
+/**
+ * @brief Scheduler Task Entry
+ * @note delay and releases are updated by the tick interrupt, the other members are updated by the dispatcher.
+ */
+typedef struct
+{
+    sch_task_t       task;          /* Task function (NULL_PTR means free entry)        */
+    uint16_t         period;        /* Release period in ticks                          */
+    uint16_t         delay;         /* Ticks until the next release                     */
+    uint8_t          releases;      /* Releases which have not been dispatched yet      */
+    sch_task_stats_t stats;         /* Measured statistics                              */
+}sch_task_entry_t;
+
+#endif
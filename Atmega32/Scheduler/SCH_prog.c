@@ -0,0 +1,338 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 14:23:18                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 21:28:00                              *
+ * @FilePath              : SCH_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "../Timebase/TB_int.h"
+#include "../ModeManager/MM_int.h"
+#include "../StackMonitor/STK_int.h"
+#include "../StackMonitor/STK_priv.h"
+#include "../StackMonitor/STK_cfg.h"
+#include "SCH_int.h"
+#include "SCH_priv.h"
+#include "SCH_cfg.h"
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Scheduler Tasks Table.
+ */
+static volatile sch_task_entry_t SCH_tasks[SCH_MAX_TASKS];
+
+/**
+ * @brief Set while the tick is running (the tick holds I/O clock resource of Mode Manager).
+ */
+static uint8_t SCH_is_started = CLEAR_VALUE;
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Timer/Counter0 Compare Match Interrupt Service Routine (Scheduler Tick).
+ * @note It only releases the tasks, the tasks are run by SCH_dispatch.
+ */
+ISR(TIMER0_COMP_VECT)
+{
+    uint8_t task_id = 0U;
+
+    /* Stamp the wake-up time if the MCU was sleeping */
+    MM_mark_wakeup();
+
+#if STK_TICK_CHECK == STK_TICK_CHECK_ENABLE
+    /* Check the stack guard (the overflow is reported by STK_scan and STK_get_stats) */
+    (void)STK_check();
+#endif
+
+    for (task_id = 0U; task_id < SCH_MAX_TASKS; task_id++)
+    {
+        /* Check if the entry is used */
+        if (SCH_tasks[task_id].task != NULL_PTR)
+        {
+            /* Check if the task is due */
+            if (SCH_tasks[task_id].delay == 0U)
+            {
+                /* Release the task and reload its delay */
+                if (SCH_tasks[task_id].releases < SCH_MAX_RELEASES)
+                {
+                    SCH_tasks[task_id].releases++;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                SCH_tasks[task_id].delay = (uint16_t)(SCH_tasks[task_id].period - 1U);
+            }
+            else
+            {
+                SCH_tasks[task_id].delay--;
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief This API is used to initialize the scheduler by stopping the tick and removing all tasks.
+ * @return The status of Scheduler (DRIVER_IS_OK).
+ */
+driver_status_t SCH_init(void)
+{
+    driver_status_t SCH_status = DRIVER_IS_OK;
+    uint8_t task_id = 0U;
+
+    /* Stop the tick */
+    ((TIMSK->bits).OCIE0) = CLEAR_VALUE;
+    (TCCR0->reg) = SCH_TIMER_STOPPED;
+
+    /* Release I/O clock which has been needed by the tick */
+    if (SCH_is_started == SET_VALUE)
+    {
+        SCH_is_started = CLEAR_VALUE;
+        (void)MM_release(MM_IO_CLK_RESOURCE);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Remove all tasks */
+    for (task_id = 0U; task_id < SCH_MAX_TASKS; task_id++)
+    {
+        SCH_tasks[task_id].task = NULL_PTR;
+        SCH_tasks[task_id].releases = SCH_NO_RELEASES;
+    }
+
+    /* Return Scheduler status */
+    return SCH_status;
+}
+
+/**
+ * @brief This API is used to add a periodic task to the scheduler.
+ * @param task The task function.
+ * @param period The release period of the task in ticks (must not be 0).
+ * @param offset The ticks before the first release, it is used to place the tasks in different slots.
+ * @param budget The execution budget of the task in Timebase ticks (0 means no budget).
+ * @param task_id A pointer to the id of the task which is used to get its statistics.
+ * @return The task id and the status of Scheduler (DRIVER_IS_OK, SCH_TASKS_ARE_FULL, VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER
+ * or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t SCH_add_task(sch_task_t task, uint16_t period, uint16_t offset, uint16_t budget, uint8_t * task_id)
+{
+    driver_status_t SCH_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint8_t index = 0U;
+
+    /* Check if the pointers are null pointers */
+    if ((task == NULL_PTR) || (task_id == NULL_PTR))
+    {
+        SCH_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the period is accepted */
+    else if (period == SCH_NO_PERIOD)
+    {
+        SCH_status = VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER;
+    }
+    else
+    {
+        /* Find a free entry */
+        while ((index < SCH_MAX_TASKS) && (SCH_tasks[index].task != NULL_PTR))
+        {
+            index++;
+        }
+
+        if (index < SCH_MAX_TASKS)
+        {
+            /* Save Interrupts state and disable them while the entry is filled */
+            ATOMIC_ENTER(sreg_state, ILT_SCH_ADD_TASK);
+
+            SCH_tasks[index].period = period;
+            SCH_tasks[index].delay = offset;
+            SCH_tasks[index].releases = SCH_NO_RELEASES;
+            SCH_tasks[index].stats.last_ticks = 0U;
+            SCH_tasks[index].stats.wcet_ticks = 0U;
+            SCH_tasks[index].stats.budget_ticks = budget;
+            SCH_tasks[index].stats.runs = 0U;
+            SCH_tasks[index].stats.overruns = 0U;
+            SCH_tasks[index].stats.missed_slots = 0U;
+            SCH_tasks[index].task = task;
+
+            /* Restore Interrupts state */
+            ATOMIC_EXIT(sreg_state, ILT_SCH_ADD_TASK);
+
+            *task_id = index;
+        }
+        else
+        {
+            /* No free entry */
+            SCH_status = SCH_TASKS_ARE_FULL;
+        }
+    }
+
+    /* Return Scheduler status */
+    return SCH_status;
+}
+
+/**
+ * @brief This API is used to start the Timebase and the scheduler tick, then enable Global Interrupt.
+ * @note Timer/Counter0 is used in CTC Mode and Timer/Counter1 is used by the Timebase to measure the tasks.
+ * @note The tick needs I/O clock, so MM_idle only selects Idle Mode while the scheduler is started.
+ * @return The status of Scheduler (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t SCH_start(void)
+{
+    driver_status_t SCH_status = DRIVER_IS_OK;
+
+    /* Check if the prescaler is existed or not */
+    if ((SCH_TICK_PRESCALER >= SCH_PRESCALER_1) && (SCH_TICK_PRESCALER <= SCH_PRESCALER_1024))
+    {
+        /* Start the Timebase which measures the execution times */
+        SCH_status = TB_init();
+
+        /* Set CTC Mode and the tick period */
+        (TCCR0->reg) = SCH_TIMER_STOPPED;
+        ((TCCR0->bits).WGM01) = SCH_CTC_MODE;
+        (TCNT0->reg) = CLEAR_VALUE;
+        (OCR0->reg) = SCH_TICK_COMPARE;
+
+        /* Keep I/O clock running in sleep, so the tick wakes up the MCU */
+        if (SCH_is_started == CLEAR_VALUE)
+        {
+            SCH_is_started = SET_VALUE;
+            (void)MM_acquire(MM_IO_CLK_RESOURCE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Enable Compare Match Interrupt and Global Interrupt */
+        ((TIMSK->bits).OCIE0) = SET_VALUE;
+        ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+
+        /* Start Timer with the selected prescaler */
+        ((TCCR0->bits).CS0) = SCH_TICK_PRESCALER;
+    }
+    else
+    {
+        /* Prescaler value is not existed */
+        SCH_status = VALUE_IS_NOT_EXISTED;
+    }
+
+    /* Return Scheduler status */
+    return SCH_status;
+}
+
+/**
+ * @brief This API is used to run the released tasks and measure their execution times.
+ * @note It must be called in the super loop, the tasks run in the order of the tasks table.
+ * @note If a task has been released more than once since its last run, it runs once and the other releases are
+ * counted as missed slots.
+ * @note Execution times are measured by TB_get_ticks32 and include the interrupts which are served while the task runs.
+ * @return The status of Scheduler (DRIVER_IS_OK or SCH_TASK_OVERRUN if a task exceeded its budget).
+ */
+driver_status_t SCH_dispatch(void)
+{
+    driver_status_t SCH_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint8_t task_id = 0U;
+    uint8_t releases = SCH_NO_RELEASES;
+    uint32_t start = 0U;
+    uint32_t ticks = 0U;
+
+    for (task_id = 0U; task_id < SCH_MAX_TASKS; task_id++)
+    {
+        /* Take the releases of the task */
+        ATOMIC_ENTER(sreg_state, ILT_SCH_DISPATCH);
+        releases = SCH_tasks[task_id].releases;
+        SCH_tasks[task_id].releases = SCH_NO_RELEASES;
+        ATOMIC_EXIT(sreg_state, ILT_SCH_DISPATCH);
+
+        /* Check if the task is released */
+        if ((releases != SCH_NO_RELEASES) && (SCH_tasks[task_id].task != NULL_PTR))
+        {
+            /* Count the missed slots */
+            SCH_tasks[task_id].stats.missed_slots += (uint16_t)(releases - 1U);
+
+            /* Run the task and measure its execution time */
+            start = TB_get_ticks32();
+            SCH_tasks[task_id].task();
+            ticks = TB_get_ticks32() - start;
+
+            /* Update the statistics */
+            SCH_tasks[task_id].stats.last_ticks = ticks;
+            SCH_tasks[task_id].stats.runs++;
+            if (ticks > SCH_tasks[task_id].stats.wcet_ticks)
+            {
+                SCH_tasks[task_id].stats.wcet_ticks = ticks;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* Check the budget of the task */
+            if ((SCH_tasks[task_id].stats.budget_ticks != SCH_NO_BUDGET) && (ticks > SCH_tasks[task_id].stats.budget_ticks))
+            {
+                SCH_tasks[task_id].stats.overruns++;
+                SCH_status = SCH_TASK_OVERRUN;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    /* Return Scheduler status */
+    return SCH_status;
+}
+
+/**
+ * @brief This API is used to get the measured statistics of a task.
+ * @param task_id The id of the task (returned by SCH_add_task).
+ * @param stats A pointer to the statistics of the task.
+ * @return The statistics and the status of Scheduler (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t SCH_get_task_stats(uint8_t task_id, sch_task_stats_t * stats)
+{
+    driver_status_t SCH_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (stats == NULL_PTR)
+    {
+        SCH_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the task is existed or not */
+    else if ((task_id >= SCH_MAX_TASKS) || (SCH_tasks[task_id].task == NULL_PTR))
+    {
+        SCH_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        *stats = SCH_tasks[task_id].stats;
+    }
+
+    /* Return Scheduler status */
+    return SCH_status;
+}
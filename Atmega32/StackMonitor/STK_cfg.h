@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 18:11:58                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 18:11:58                              *
+ * @FilePath              : STK_cfg.h                                        *
+ ****************************************************************************/
+
+#ifndef STACKMONITOR_STK_CFG_H_
+#define STACKMONITOR_STK_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Paint Margin
+ * @note Number of bytes below the stack pointer of STK_init which are not painted, they are kept for the frames
+ * of STK_init itself.
+ */
+
+#define STK_PAINT_MARGIN        16U
+
+/**
+ * @brief Guard Size
+ * @note Number of painted bytes right after the end of .bss which are checked by STK_check, the stack is reported
+ * as overflowed as soon as one of them is used.
+ * @note Minimum value is 1.
+ */
+
+#define STK_GUARD_SIZE          16U
+
+/**
+ * @brief Scan Budget
+ * @note Maximum number of painted bytes which are checked per STK_scan call (e.g. from the idle time before MM_idle).
+ * @note Minimum value is 1.
+ */
+
+#define STK_SCAN_BUDGET         32U
+
+/**
+ * @brief Scheduler Tick Check Configuration
+ * @note Options are STK_TICK_CHECK_DISABLE or STK_TICK_CHECK_ENABLE
+ * @note If it is enabled, STK_check is called from the scheduler tick (STK_GUARD_SIZE reads per tick).
+ */
+
+#define STK_TICK_CHECK          STK_TICK_CHECK_DISABLE
+
+#endif
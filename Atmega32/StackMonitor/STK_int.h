@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 18:11:26                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 18:11:26                              *
+ * @FilePath              : STK_int.h                                        *
+ ****************************************************************************/
+
+#ifndef STACKMONITOR_STK_INT_H_
+#define STACKMONITOR_STK_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section Typedefs
+ */
+
+/**
+ * @brief Stack Usage
+ * @note The used bytes are counted from the last SRAM Address down to the lowest stack byte which has been found
+ * changed (high-water mark), so the stack bytes which were used before STK_init are included.
+ */
+typedef struct
+{
+    uint16_t size_bytes;          /* Bytes from the end of .bss to the last SRAM Address         */
+    uint16_t max_used_bytes;      /* Stack high-water mark                                       */
+    uint16_t min_free_bytes;      /* Painted bytes which have never been used                    */
+    uint8_t  is_overflowed;       /* SET_VALUE if the guard bytes have been used (sticky)        */
+}stk_stats_t;
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t STK_init      (void);
+driver_status_t STK_scan      (void);
+driver_status_t STK_check     (void);
+driver_status_t STK_get_stats (stk_stats_t * stats);
+
+#endif
@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 18:12:31                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 18:12:31                              *
+ * @FilePath              : STK_priv.h                                       *
+ ****************************************************************************/
+
+#ifndef STACKMONITOR_STK_PRIV_H_
+#define STACKMONITOR_STK_PRIV_H_
+
+/**
+ * @section Configuration Options
+ */
+
+/**
+ * @brief Scheduler Tick Check Options
+ */
+
+#define STK_TICK_CHECK_DISABLE  0U
+#define STK_TICK_CHECK_ENABLE   1U
+
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Stack Painting
+ * @note A stack byte which holds the canary value by chance is counted as not used.
+ */
+
+#define STK_CANARY              0xC5U
+#define STK_RAM_END             0x085FU
+#define STK_SP_MOST_BYTE        8U
+#define STK_NO_BYTES            0U
+
+/**
+ * @brief SRAM Access
+ * @note On target, the free SRAM starts at _end (end of .bss defined by the linker script).
+ * @note On host (HOST_SIM build), the simulated SRAM is used.
+ */
+#if defined(HOST_SIM)
+#define STK_RAM_BYTE(address)   (SIM_data_space[(address)])
+#define STK_DATA_END            SIM_DATA_END_ADDRESS
+#else
+extern uint8_t _end;
+#define STK_RAM_BYTE(address)   (*((volatile uint8_t *)(uintptr_t)(address)))
+#define STK_DATA_END            ((uint16_t)(uintptr_t)&_end)
+#endif
+
+#endif
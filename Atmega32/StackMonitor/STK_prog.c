@@ -0,0 +1,244 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 18:13:04                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 18:13:04                              *
+ * @FilePath              : STK_prog.c                                       *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "STK_int.h"
+#include "STK_priv.h"
+#include "STK_cfg.h"
+
+#if (STK_GUARD_SIZE < 1U) || (STK_SCAN_BUDGET < 1U)
+#error "STK_GUARD_SIZE and STK_SCAN_BUDGET must be 1 at least"
+#endif
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Painted SRAM (STK_bottom -> STK_top), the lowest stack byte which has been found used (high-water mark) and
+ * the next byte to be checked by the scan.
+ */
+static uint16_t STK_bottom = STK_NO_BYTES;
+static uint16_t STK_top = STK_NO_BYTES;
+static uint16_t STK_watermark = STK_NO_BYTES;
+static uint16_t STK_cursor = STK_NO_BYTES;
+
+/**
+ * @brief Set when the guard bytes have been used.
+ */
+static volatile uint8_t STK_is_overflowed = CLEAR_VALUE;
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to read the stack pointer.
+ * @return The stack pointer.
+ */
+static uint16_t STK_get_sp(void)
+{
+    uint8_t low_byte = (SPL->reg);
+    uint8_t high_byte = (SPH->reg);
+
+    return (uint16_t)(((uint16_t)high_byte << STK_SP_MOST_BYTE) | low_byte);
+}
+
+
+/**
+ * @section APIs Implementation
+ */
+
+/**
+ * @brief This API is used to paint the free SRAM between the end of .bss and the stack with the canary value.
+ * @note It must be called at the beginning of main, before the stack grows and before the heap is used.
+ * @note Interrupts are disabled while painting, so the frames of the ISRs are not painted.
+ * @return The status of Stack Monitor (DRIVER_IS_OK or STK_STACK_OVERFLOW if the free SRAM is smaller than the guard).
+ */
+driver_status_t STK_init(void)
+{
+    driver_status_t STK_status = DRIVER_IS_OK;
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint16_t address = STK_NO_BYTES;
+    uint16_t stack_pointer = STK_NO_BYTES;
+
+    ATOMIC_ENTER(sreg_state, ILT_STK_INIT);
+
+    /* Check if there is free SRAM below the stack */
+    stack_pointer = STK_get_sp();
+    if (stack_pointer < (uint16_t)(STK_DATA_END + STK_GUARD_SIZE + STK_PAINT_MARGIN))
+    {
+        STK_is_overflowed = SET_VALUE;
+        STK_status = STK_STACK_OVERFLOW;
+    }
+    else
+    {
+        STK_bottom = STK_DATA_END;
+        STK_top = (uint16_t)(stack_pointer - STK_PAINT_MARGIN);
+
+        /* Paint the free SRAM */
+        for (address = STK_bottom; address <= STK_top; address++)
+        {
+            STK_RAM_BYTE(address) = STK_CANARY;
+        }
+
+        /* Nothing is used yet */
+        STK_watermark = (uint16_t)(STK_top + 1U);
+        STK_cursor = STK_bottom;
+        STK_is_overflowed = CLEAR_VALUE;
+    }
+
+    ATOMIC_EXIT(sreg_state, ILT_STK_INIT);
+
+    /* Return Stack Monitor status */
+    return STK_status;
+}
+
+/**
+ * @brief This API is used to scan the painted SRAM for the lowest used stack byte (high-water mark).
+ * @note The bytes are checked from the end of .bss up to the high-water mark, STK_SCAN_BUDGET bytes per call at most,
+ * so it can be called from the idle time (e.g. before MM_idle) and a whole pass is completed over many calls.
+ * @return The status of Stack Monitor (DRIVER_IS_OK or STK_STACK_OVERFLOW if the guard bytes have been used).
+ */
+driver_status_t STK_scan(void)
+{
+    driver_status_t STK_status = DRIVER_IS_OK;
+    uint16_t count = STK_NO_BYTES;
+    uint8_t is_done = CLEAR_VALUE;
+
+    while ((count < STK_SCAN_BUDGET) && (is_done == CLEAR_VALUE))
+    {
+        /* Check if the pass reached the high-water mark */
+        if (STK_cursor >= STK_watermark)
+        {
+            is_done = SET_VALUE;
+        }
+        /* Check if the byte has been used */
+        else if (STK_RAM_BYTE(STK_cursor) != STK_CANARY)
+        {
+            STK_watermark = STK_cursor;
+            is_done = SET_VALUE;
+        }
+        else
+        {
+            STK_cursor++;
+            count++;
+        }
+    }
+
+    /* Start the next pass */
+    if (is_done == SET_VALUE)
+    {
+        STK_cursor = STK_bottom;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Check if the guard bytes have been used */
+    if (STK_watermark < (uint16_t)(STK_bottom + STK_GUARD_SIZE))
+    {
+        STK_is_overflowed = SET_VALUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    STK_status = (STK_is_overflowed == SET_VALUE) ? STK_STACK_OVERFLOW : DRIVER_IS_OK;
+
+    /* Return Stack Monitor status */
+    return STK_status;
+}
+
+/**
+ * @brief This API is used to check the stack pointer and the guard bytes quickly.
+ * @note It is called from the scheduler tick if STK_TICK_CHECK is enabled, so the overflow is detected when the stack
+ * reaches the guard bytes and before it corrupts .bss.
+ * @return The status of Stack Monitor (DRIVER_IS_OK or STK_STACK_OVERFLOW).
+ */
+driver_status_t STK_check(void)
+{
+    driver_status_t STK_status = DRIVER_IS_OK;
+    uint16_t address = STK_NO_BYTES;
+
+    /* Check if the stack is painted */
+    if (STK_top != STK_NO_BYTES)
+    {
+        /* Check the stack pointer */
+        if (STK_get_sp() < (uint16_t)(STK_bottom + STK_GUARD_SIZE))
+        {
+            STK_is_overflowed = SET_VALUE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Check the guard bytes */
+        for (address = STK_bottom; address < (uint16_t)(STK_bottom + STK_GUARD_SIZE); address++)
+        {
+            if (STK_RAM_BYTE(address) != STK_CANARY)
+            {
+                STK_is_overflowed = SET_VALUE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    STK_status = (STK_is_overflowed == SET_VALUE) ? STK_STACK_OVERFLOW : DRIVER_IS_OK;
+
+    /* Return Stack Monitor status */
+    return STK_status;
+}
+
+/**
+ * @brief This API is used to get the stack usage found by the last scans.
+ * @param stats A pointer to the stack usage.
+ * @return The stack usage and the status of Stack Monitor (DRIVER_IS_OK, VALUE_IS_NOT_EXISTED if the stack is not
+ * painted or PTR_USED_IS_NULL_PTR).
+ */
+driver_status_t STK_get_stats(stk_stats_t * stats)
+{
+    driver_status_t STK_status = DRIVER_IS_OK;
+
+    /* Check if the pointer is null pointer */
+    if (stats == NULL_PTR)
+    {
+        STK_status = PTR_USED_IS_NULL_PTR;
+    }
+    /* Check if the stack is painted */
+    else if (STK_top == STK_NO_BYTES)
+    {
+        STK_status = VALUE_IS_NOT_EXISTED;
+    }
+    else
+    {
+        stats->size_bytes = (uint16_t)(STK_RAM_END - STK_bottom + 1U);
+        stats->max_used_bytes = (uint16_t)(STK_RAM_END - STK_watermark + 1U);
+        stats->min_free_bytes = (uint16_t)(STK_watermark - STK_bottom);
+        stats->is_overflowed = STK_is_overflowed;
+    }
+
+    /* Return Stack Monitor status */
+    return STK_status;
+}
@@ -0,0 +1,24 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:20:47                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 11:20:47                              *
+ * @FilePath              : TB_cfg.h                                         *
+ ****************************************************************************/
+
+#ifndef TIMEBASE_TB_CFG_H_
+#define TIMEBASE_TB_CFG_H_
+
+/**
+ * @section Configurations
+ */
+
+/**
+ * @brief Timebase Prescaler Configuration
+ * @note Options are TB_PRESCALER_1, TB_PRESCALER_8, TB_PRESCALER_64, TB_PRESCALER_256 or TB_PRESCALER_1024
+ * @note TB_PRESCALER_1 makes each tick equal to one CPU cycle (Timer/Counter1 wraps every 65536 cycles).
+ */
+
+#define TB_PRESCALER        TB_PRESCALER_1
+
+#endif
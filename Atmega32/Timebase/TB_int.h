@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:20:05                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:17:00                              *
+ * @FilePath              : TB_int.h                                         *
+ ****************************************************************************/
+
+#ifndef TIMEBASE_TB_INT_H_
+#define TIMEBASE_TB_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../../MC_driver.h"
+
+
+/**
+ * @section APIs
+ */
+
+driver_status_t TB_init        (void);
+uint16_t        TB_get_ticks   (void);
+uint32_t        TB_get_ticks32 (void);
+driver_status_t TB_add_overflows(uint16_t overflows);
+
+#endif
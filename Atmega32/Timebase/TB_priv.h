@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:21:16                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-17 20:20:00                              *
+ * @FilePath              : TB_priv.h                                        *
+ ****************************************************************************/
+
+#ifndef TIMEBASE_TB_PRIV_H_
+#define TIMEBASE_TB_PRIV_H_
+
+/**
+ * @section Configuration Options
+ */
+
+/**
+ * @brief Prescaler Options (Timer/Counter1 Clock Select values)
+ */
+
+#define TB_PRESCALER_1                  1U
+#define TB_PRESCALER_8                  2U
+#define TB_PRESCALER_64                 3U
+#define TB_PRESCALER_256                4U
+#define TB_PRESCALER_1024               5U
+
+/**
+ * @section Magic Numbers
+ */
+
+/**
+ * @brief Timer/Counter1 Normal Mode
+ */
+
+#define TB_NORMAL_MODE                  0U
+
+/**
+ * @brief Ticks High byte position
+ */
+
+#define TB_TICKS_MOST_BYTE              8U
+
+/**
+ * @brief Overflows count position in the extended ticks
+ */
+
+#define TB_OVERFLOWS_POSITION           16U
+
+/**
+ * @brief Half period of Timer/Counter1 (ticks which are read before it are read after a pending overflow)
+ */
+
+#define TB_HALF_PERIOD                  0x8000U
+
+#endif
@@ -0,0 +1,159 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 11:22:03                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:17:00                              *
+ * @FilePath              : TB_prog.c                                        *
+ ****************************************************************************/
+
+/**
+ * @section Includes
+ */
+
+#include "../atmega32_reg.h"
+#include "../IrqLatency/ILT_int.h"
+#include "../ModeManager/MM_int.h"
+#include "TB_int.h"
+#include "TB_priv.h"
+#include "TB_cfg.h"
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Number of Timer/Counter1 overflows since TB_init (the high word of the extended ticks).
+ */
+static volatile uint16_t TB_overflows = 0U;
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief This API is used to start Timer/Counter1 as free-running timebase with the configured prescaler.
+ * @note The Timer/Counter1 is used in Normal Mode and must not be reconfigured by other drivers.
+ * @note Timer/Counter1 Overflow Interrupt is enabled to count the overflows for TB_get_ticks32.
+ * @note If the timebase is already started, it keeps counting, so each user (Scheduler, Interrupt Latency Tracker,
+ * Benchmark) can call it without breaking the time stamps of the others.
+ * @return The status of Timebase (DRIVER_IS_OK or VALUE_IS_NOT_EXISTED).
+ */
+driver_status_t TB_init(void)
+{
+    driver_status_t TB_status = DRIVER_IS_OK;
+
+    /* Check if the prescaler is existed or not */
+    if ((TB_PRESCALER < TB_PRESCALER_1) || (TB_PRESCALER > TB_PRESCALER_1024))
+    {
+        /* Prescaler value is not existed */
+        TB_status = VALUE_IS_NOT_EXISTED;
+    }
+    /* Check if the timebase is already started */
+    else if (((TCCR1B->bits).CS1) == TB_PRESCALER)
+    {
+        /* Do Nothing */
+    }
+    else
+    {
+        /* Set Normal Mode */
+        (TCCR1A->reg) = TB_NORMAL_MODE;
+        (TCCR1B->reg) = TB_NORMAL_MODE;
+
+        /* Start counting from zero */
+        (TCNT1H->reg) = CLEAR_VALUE;
+        (TCNT1L->reg) = CLEAR_VALUE;
+        TB_overflows = 0U;
+
+        /* Enable Overflow Interrupt to extend the ticks */
+        ((TIMSK->bits).TOIE1) = SET_VALUE;
+
+        /* Start Timer with the selected prescaler */
+        ((TCCR1B->bits).CS1) = TB_PRESCALER;
+    }
+
+    /* Return Timebase status */
+    return TB_status;
+}
+
+/**
+ * @brief This API is used to get the current ticks of the timebase.
+ * @note Differences between two readings are valid across the wrap if they are computed in uint16_t.
+ * @return The current ticks.
+ */
+uint16_t TB_get_ticks(void)
+{
+    uint8_t low_byte = CLEAR_VALUE;
+    uint8_t high_byte = CLEAR_VALUE;
+
+    /* Read Low byte first to latch High byte */
+    low_byte = (TCNT1L->reg);
+    high_byte = (TCNT1H->reg);
+
+    /* Return the ticks */
+    return (uint16_t)(((uint16_t)high_byte << TB_TICKS_MOST_BYTE) | low_byte);
+}
+
+/**
+ * @brief This API is used to get the current ticks of the timebase extended by the overflows count.
+ * @note Differences between two readings are valid across the wrap if they are computed in uint32_t.
+ * @note The overflows are counted by Timer/Counter1 Overflow Interrupt, so while Global Interrupt is disabled
+ * only one overflow (the pending flag) is seen.
+ * @return The current extended ticks.
+ */
+uint32_t TB_get_ticks32(void)
+{
+    uint8_t sreg_state = CLEAR_VALUE;
+    uint16_t overflows = 0U;
+    uint16_t ticks = 0U;
+
+    /* Read the overflows and the counter with Interrupts disabled */
+    ATOMIC_ENTER(sreg_state, ILT_TB_GET_TICKS);
+    overflows = TB_overflows;
+    ticks = TB_get_ticks();
+
+    /* Check if there is an overflow which is not served yet (the counter has been read after it) */
+    if ((((TIFR->bits).TOV1) == SET_VALUE) && (ticks < TB_HALF_PERIOD))
+    {
+        overflows++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    ATOMIC_EXIT(sreg_state, ILT_TB_GET_TICKS);
+
+    /* Return the extended ticks */
+    return (((uint32_t)overflows << TB_OVERFLOWS_POSITION) | ticks);
+}
+
+/**
+ * @brief This API is used to count the overflows which have been missed while Global Interrupt was disabled.
+ * @param overflows The number of missed overflows, the last overflow of the disabled block is not missed as its flag
+ * stays pending and it is counted by Timer/Counter1 Overflow Interrupt.
+ * @note It must be called with Global Interrupt disabled, by a block which disables it longer than the timer period and
+ * counts the wraps of TB_get_ticks meanwhile (e.g. LCAP_capture).
+ * @return The status of Timebase (DRIVER_IS_OK).
+ */
+driver_status_t TB_add_overflows(uint16_t overflows)
+{
+    driver_status_t TB_status = DRIVER_IS_OK;
+
+    /* Extend the high word of the ticks */
+    TB_overflows = (uint16_t)(TB_overflows + overflows);
+
+    /* Return Timebase status */
+    return TB_status;
+}
+
+/**
+ * @brief Timer/Counter1 Overflow Interrupt Service Routine.
+ * @note It counts the overflows of the timebase (the flag is cleared by hardware).
+ * @note The wake-up time is stamped after the count, as the cleared flag can not be seen by TB_get_ticks32.
+ */
+ISR(TIMER1_OVF_VECT)
+{
+    TB_overflows++;
+
+    /* Stamp the wake-up time if the MCU was sleeping */
+    MM_mark_wakeup();
+}
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
  * @CreatedDate           : 2023-06-25 12:55:48                              *
  * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
- * @LastEditDate          : 2023-08-28 11:23:53                              *
+ * @LastEditDate          : 2026-10-17 14:23:00                              *
  * @FilePath              : atmega32_reg.h                                   *
  ****************************************************************************/
 
@@ -15,6 +15,28 @@
 
 #include "../MC_driver.h"
 
+#if defined(HOST_SIM)
+#include "HostSim/SIM_int.h"
+#endif
+
+/**
+ * @section Registers Access
+ */
+
+/**
+ * @brief Registers Address and Access Mapping.
+ * @note On target, registers are accessed directly at their fixed Memory locations.
+ * @note On host (HOST_SIM build), registers are placed in a simulated I/O space and every access
+ * runs the behavioral models of the simulator before the register is read or written.
+ */
+#if defined(HOST_SIM)
+#define IO_ADDRESS(address)     (&SIM_io_space[(address)])
+#define IO_ACCESS(reg)          ((__typeof__(reg)) SIM_io_access((volatile void *)(reg)))
+#else
+#define IO_ADDRESS(address)     (address)
+#define IO_ACCESS(reg)          (reg)
+#endif
+
 /**
  * @section Atmega32 Registers
  */
@@ -51,7 +73,7 @@ typedef union
 /**
  * @brief Map Status Register and its bits to its Memory location.
  */
-#define SREG       ((volatile SREG_t *) SREG_ADDRESS)    
+#define SREG       IO_ACCESS((volatile SREG_t *) IO_ADDRESS(SREG_ADDRESS))    
 
 
 /**
@@ -104,8 +126,8 @@ typedef union
 /**
  * @brief Map Stack Pointer Registers and their bits to their Memory locations.
  */
-#define SPL       ((volatile SPL_t *) SPL_ADDRESS)  
-#define SPH       ((volatile SPH_t *) SPH_ADDRESS)
+#define SPL       IO_ACCESS((volatile SPL_t *) IO_ADDRESS(SPL_ADDRESS))  
+#define SPH       IO_ACCESS((volatile SPH_t *) IO_ADDRESS(SPH_ADDRESS))
 
 
 /**
@@ -201,7 +223,7 @@ typedef struct
 /**
  * @brief Map EEPROM Registers and their bits to their Memory locations.
  */
-#define EEPROM       ((EEPROM_Reg_S *) EEPROM_BASE_ADDRESS)
+#define EEPROM       IO_ACCESS((EEPROM_Reg_S *) IO_ADDRESS(EEPROM_BASE_ADDRESS))
 
 
 /**
@@ -235,7 +257,7 @@ typedef union
 /**
  * @brief Map Store Program Memory Control Register and its bits to its Memory location.
  */
-#define SPMCR       ((volatile SPMCR_t *) SPMCR_ADDRESS)    
+#define SPMCR       IO_ACCESS((volatile SPMCR_t *) IO_ADDRESS(SPMCR_ADDRESS))    
 
 
 /**
@@ -274,7 +296,7 @@ typedef union
 /**
  * @brief Map Oscillator Calibration Register and its bits to its Memory location.
  */
-#define OSCAL       ((volatile OSCCAL_t *) OSCCAL_ADDRESS) 
+#define OSCAL       IO_ACCESS((volatile OSCCAL_t *) IO_ADDRESS(OSCCAL_ADDRESS)) 
 
 
 /**
@@ -306,7 +328,7 @@ typedef union
 /**
  * @brief Map MCU Control Register and its bits to its Memory location.
  */
-#define MCUCR       ((volatile MCUCR_t *) MCUCR_ADDRESS)    
+#define MCUCR       IO_ACCESS((volatile MCUCR_t *) IO_ADDRESS(MCUCR_ADDRESS))    
 
 
 /**
@@ -340,7 +362,159 @@ typedef union
 /**
  * @brief Map SFIOR and its bits to its Memory location.
  */
-#define SFIOR       ((volatile SFIOR_t *) SFIOR_ADDRESS)    
+#define SFIOR       IO_ACCESS((volatile SFIOR_t *) IO_ADDRESS(SFIOR_ADDRESS))    
+
+
+/**
+ * @brief Timer/Counter1 Control Registers and their bits . (R/W Registers)
+ * @note Timer/Counter1 Control Register A (TCCR1A) selects the Compare Output Modes and the Waveform Generation Mode (WGM11:10).
+ * @note Timer/Counter1 Control Register B (TCCR1B) selects the Clock Source and the Waveform Generation Mode (WGM13:12).
+ * @note TCCR1A and TCCR1B initial Values are 0x00 (Normal Mode, Timer stopped).
+ */
+
+typedef union 
+{
+    uint8_t reg;
+    struct 
+    {
+        uint8_t WGM10    : 1;    /* Waveform Generation Mode Bit 0         */
+        uint8_t WGM11    : 1;    /* Waveform Generation Mode Bit 1         */
+        uint8_t FOC1B    : 1;    /* Force Output Compare for Channel B     */
+        uint8_t FOC1A    : 1;    /* Force Output Compare for Channel A     */
+        uint8_t COM1B    : 2;    /* Compare Output Mode for Channel B Bits */
+        uint8_t COM1A    : 2;    /* Compare Output Mode for Channel A Bits */
+    }bits;
+
+}TCCR1A_t;
+
+typedef union 
+{
+    uint8_t reg;
+    struct 
+    {
+        uint8_t CS1      : 3;    /* Clock Select Bits                      */
+        uint8_t WGM12    : 1;    /* Waveform Generation Mode Bit 2         */
+        uint8_t WGM13    : 1;    /* Waveform Generation Mode Bit 3         */
+        uint8_t Reserved : 1;    /* Reserved bit                           */
+        uint8_t ICES1    : 1;    /* Input Capture Edge Select              */
+        uint8_t ICNC1    : 1;    /* Input Capture Noise Canceler           */
+    }bits;
+
+}TCCR1B_t;
+
+/**
+ * @brief Timer/Counter1 Data Registers. (R/W Registers)
+ * @note Timer/Counter1 (TCNT1), Output Compare Register 1A (OCR1A) are 16-bit registers divided into two 8-bit registers (Low, High).
+ * @note The Low byte must be read first (High byte is latched in TEMP register), and the High byte must be written first.
+ * @note TCNT1 and OCR1A initial Values are 0x0000.
+ */
+
+typedef union 
+{
+    uint8_t reg;
+
+}TIMER_DATA_t;
+
+/**
+ * @brief Timer/Counter Interrupt Mask Register (TIMSK) and Interrupt Flag Register (TIFR) and their bits. (R/W Registers)
+ * @note TIMSK and TIFR are shared between Timer/Counter0, Timer/Counter1 and Timer/Counter2.
+ * @note TIFR flags are cleared by writing logic one to them.
+ * @note TIMSK and TIFR initial Values are 0x00.
+ */
+
+typedef union 
+{
+    uint8_t reg;
+    struct 
+    {
+        uint8_t TOIE0    : 1;    /* Timer/Counter0 Overflow Interrupt Enable              */
+        uint8_t OCIE0    : 1;    /* Timer/Counter0 Output Compare Match Interrupt Enable  */
+        uint8_t TOIE1    : 1;    /* Timer/Counter1 Overflow Interrupt Enable              */
+        uint8_t OCIE1B   : 1;    /* Timer/Counter1 Output Compare B Match Interrupt Enable*/
+        uint8_t OCIE1A   : 1;    /* Timer/Counter1 Output Compare A Match Interrupt Enable*/
+        uint8_t TICIE1   : 1;    /* Timer/Counter1 Input Capture Interrupt Enable         */
+        uint8_t TOIE2    : 1;    /* Timer/Counter2 Overflow Interrupt Enable              */
+        uint8_t OCIE2    : 1;    /* Timer/Counter2 Output Compare Match Interrupt Enable  */
+    }bits;
+
+}TIMSK_t;
+
+typedef union 
+{
+    uint8_t reg;
+    struct 
+    {
+        uint8_t TOV0     : 1;    /* Timer/Counter0 Overflow Flag              */
+        uint8_t OCF0     : 1;    /* Timer/Counter0 Output Compare Flag        */
+        uint8_t TOV1     : 1;    /* Timer/Counter1 Overflow Flag              */
+        uint8_t OCF1B    : 1;    /* Timer/Counter1 Output Compare B Match Flag*/
+        uint8_t OCF1A    : 1;    /* Timer/Counter1 Output Compare A Match Flag*/
+        uint8_t ICF1     : 1;    /* Timer/Counter1 Input Capture Flag         */
+        uint8_t TOV2     : 1;    /* Timer/Counter2 Overflow Flag              */
+        uint8_t OCF2     : 1;    /* Timer/Counter2 Output Compare Flag        */
+    }bits;
+
+}TIFR_t;
+
+/**
+ * @brief Timer/Counter1 and Timer Interrupts Registers Addresses.
+ */
+#define TCCR1A_ADDRESS          0x4FU
+#define TCCR1B_ADDRESS          0x4EU
+#define TCNT1H_ADDRESS          0x4DU
+#define TCNT1L_ADDRESS          0x4CU
+#define OCR1AH_ADDRESS          0x4BU
+#define OCR1AL_ADDRESS          0x4AU
+#define TIMSK_ADDRESS           0x59U
+#define TIFR_ADDRESS            0x58U
+
+/**
+ * @brief Map Timer/Counter1 and Timer Interrupts Registers and their bits to their Memory locations.
+ */
+#define TCCR1A      IO_ACCESS((volatile TCCR1A_t *) IO_ADDRESS(TCCR1A_ADDRESS))
+#define TCCR1B      IO_ACCESS((volatile TCCR1B_t *) IO_ADDRESS(TCCR1B_ADDRESS))
+#define TCNT1H      IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(TCNT1H_ADDRESS))
+#define TCNT1L      IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(TCNT1L_ADDRESS))
+#define OCR1AH      IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(OCR1AH_ADDRESS))
+#define OCR1AL      IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(OCR1AL_ADDRESS))
+#define TIMSK       IO_ACCESS((volatile TIMSK_t *) IO_ADDRESS(TIMSK_ADDRESS))
+#define TIFR        IO_ACCESS((volatile TIFR_t *) IO_ADDRESS(TIFR_ADDRESS))
+
+
+/**
+ * @brief Timer/Counter0 Control Register (TCCR0) and its bits. (R/W Register)
+ * @note TCCR0 selects the Clock Source, the Compare Output Mode and the Waveform Generation Mode (WGM01:00).
+ * @note TCCR0 initial Value is 0x00 (Normal Mode, Timer stopped).
+ * @note Timer/Counter0 (TCNT0) and Output Compare Register 0 (OCR0) are 8-bit registers (TIMER_DATA_t).
+ */
+
+typedef union 
+{
+    uint8_t reg;
+    struct 
+    {
+        uint8_t CS0      : 3;    /* Clock Select Bits                      */
+        uint8_t WGM01    : 1;    /* Waveform Generation Mode Bit 1         */
+        uint8_t COM0     : 2;    /* Compare Match Output Mode Bits         */
+        uint8_t WGM00    : 1;    /* Waveform Generation Mode Bit 0         */
+        uint8_t FOC0     : 1;    /* Force Output Compare                   */
+    }bits;
+
+}TCCR0_t;
+
+/**
+ * @brief Timer/Counter0 Registers Addresses.
+ */
+#define TCCR0_ADDRESS           0x53U
+#define TCNT0_ADDRESS           0x52U
+#define OCR0_ADDRESS            0x5CU
+
+/**
+ * @brief Map Timer/Counter0 Registers and their bits to their Memory locations.
+ */
+#define TCCR0       IO_ACCESS((volatile TCCR0_t *) IO_ADDRESS(TCCR0_ADDRESS))
+#define TCNT0       IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(TCNT0_ADDRESS))
+#define OCR0        IO_ACCESS((volatile TIMER_DATA_t *) IO_ADDRESS(OCR0_ADDRESS))
 
 
 /**
@@ -425,10 +599,58 @@ typedef struct
 
 /**
  * @brief Map GPIO Registers and their bits to their Memory locations.
+ * @note GPIO Registers are not wrapped by IO_ACCESS so they can be used in constant tables,
+ * the user of the table must access them through IO_ACCESS.
+ */
+#define GPIO_A_REGS       ((GPIO_Reg_S *) IO_ADDRESS(GPIO_A_BASE_ADDRESS))
+#define GPIO_B_REGS       ((GPIO_Reg_S *) IO_ADDRESS(GPIO_B_BASE_ADDRESS))
+#define GPIO_C_REGS       ((GPIO_Reg_S *) IO_ADDRESS(GPIO_C_BASE_ADDRESS))
+#define GPIO_D_REGS       ((GPIO_Reg_S *) IO_ADDRESS(GPIO_D_BASE_ADDRESS))
+
+
+/**
+ * @section Atmega32 Interrupt Vectors
+ */
+
+/**
+ * @brief Interrupt Service Routine Definition.
+ * @note The vector name must be one of the vectors listed below (e.g. ISR(EE_RDY_VECT) { ... }).
+ * @note The routine is defined as signal handler so the compiler saves and restores used registers and SREG.
+ */
+#ifndef ISR
+#if defined(HOST_SIM)
+#define ISR(vector)                                                     \
+void vector(void)
+#else
+#define ISR(vector)                                                     \
+void vector(void) __attribute__((signal, used, externally_visible));   \
+void vector(void)
+#endif
+#endif
+
+/**
+ * @brief Interrupt Vectors.
+ * @note Vector 0 is the Reset vector.
  */
-#define GPIO_A_REGS       ((GPIO_Reg_S *) GPIO_A_BASE_ADDRESS)
-#define GPIO_B_REGS       ((GPIO_Reg_S *) GPIO_B_BASE_ADDRESS)
-#define GPIO_C_REGS       ((GPIO_Reg_S *) GPIO_C_BASE_ADDRESS)
-#define GPIO_D_REGS       ((GPIO_Reg_S *) GPIO_D_BASE_ADDRESS)
+#define INT0_VECT           __vector_1     /* External Interrupt Request 0        */
+#define INT1_VECT           __vector_2     /* External Interrupt Request 1        */
+#define INT2_VECT           __vector_3     /* External Interrupt Request 2        */
+#define TIMER2_COMP_VECT    __vector_4     /* Timer/Counter2 Compare Match        */
+#define TIMER2_OVF_VECT     __vector_5     /* Timer/Counter2 Overflow             */
+#define TIMER1_CAPT_VECT    __vector_6     /* Timer/Counter1 Capture Event        */
+#define TIMER1_COMPA_VECT   __vector_7     /* Timer/Counter1 Compare Match A      */
+#define TIMER1_COMPB_VECT   __vector_8     /* Timer/Counter1 Compare Match B      */
+#define TIMER1_OVF_VECT     __vector_9     /* Timer/Counter1 Overflow             */
+#define TIMER0_COMP_VECT    __vector_10    /* Timer/Counter0 Compare Match        */
+#define TIMER0_OVF_VECT     __vector_11    /* Timer/Counter0 Overflow             */
+#define SPI_STC_VECT        __vector_12    /* Serial Transfer Complete            */
+#define USART_RXC_VECT      __vector_13    /* USART Rx Complete                   */
+#define USART_UDRE_VECT     __vector_14    /* USART Data Register Empty           */
+#define USART_TXC_VECT      __vector_15    /* USART Tx Complete                   */
+#define ADC_VECT            __vector_16    /* ADC Conversion Complete             */
+#define EE_RDY_VECT         __vector_17    /* EEPROM Ready                        */
+#define ANA_COMP_VECT       __vector_18    /* Analog Comparator                   */
+#define TWI_VECT            __vector_19    /* Two-wire Serial Interface           */
+#define SPM_RDY_VECT        __vector_20    /* Store Program Memory Ready          */
 
 #endif
@@ -2,7 +2,7 @@
  * @Author                : Islam Tarek<islam.tarek@valeo.com>               *
  * @CreatedDate           : 2023-06-27 12:07:12                              *
  * @LastEditors           : Islam Tarek<islam.tarek@valeo.com>               *
- * @LastEditDate          : 2024-01-11 11:09:44                              *
+ * @LastEditDate          : 2026-10-17 18:38:00                              *
  * @FilePath              : MC_driver.h                                      *
  ****************************************************************************/
 
@@ -31,6 +31,72 @@
 #define GLOBAL_INTERRUPT_DISABLE 0U
 #define GLOBAL_INTERRUPT_ENABLE  1U
 
+/**
+ * @brief Memory Barrier
+ * @note The compiler does not move memory accesses across it, so the accesses of an atomic block stay inside it.
+ */
+#define MEMORY_BARRIER()            __asm__ __volatile__ ("" ::: "memory")
+
+/**
+ * @brief Atomic Block
+ * @note ATOMIC_ENTER saves Interrupts state in the given variable then disables them, and ATOMIC_EXIT restores the
+ * saved state, so the blocks can be nested and Interrupts which have been disabled by the caller are never enabled.
+ * @note The site is the ilt_site_t of the block, it is used by the interrupt latency tracker (IRQ_LATENCY_TRACKING
+ * build) to measure how long the outermost block keeps Interrupts disabled, otherwise it is ignored.
+ * @note SREG is defined in atmega32_reg.h, which must be included by the files that use them.
+ */
+#if defined(IRQ_LATENCY_TRACKING)
+#define ATOMIC_ENTER(sreg_state, site)  do { (sreg_state) = (SREG->reg); ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE; \
+                                             MEMORY_BARRIER();                                                         \
+                                             if (GET_BIT((sreg_state), BIT7) == GLOBAL_INTERRUPT_ENABLE)               \
+                                             { ILT_start(); } } while (0)
+#define ATOMIC_EXIT(sreg_state, site)   do { if (GET_BIT((sreg_state), BIT7) == GLOBAL_INTERRUPT_ENABLE)               \
+                                             { ILT_stop(site); }                                                       \
+                                             MEMORY_BARRIER(); (SREG->reg) = (sreg_state); } while (0)
+#else
+#define ATOMIC_ENTER(sreg_state, site)  do { (sreg_state) = (SREG->reg); ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE; \
+                                             MEMORY_BARRIER(); } while (0)
+#define ATOMIC_EXIT(sreg_state, site)   do { MEMORY_BARRIER(); (SREG->reg) = (sreg_state); } while (0)
+#endif
+
+/**
+ * @brief Interrupt Latency Marks
+ * @note They are used where Global Interrupt is enabled or disabled outside an atomic block: IRQ_LATENCY_START right
+ * after disabling it and IRQ_LATENCY_STOP right before enabling it (they are empty if IRQ_LATENCY_TRACKING is not defined).
+ */
+#if defined(IRQ_LATENCY_TRACKING)
+#define IRQ_LATENCY_START()             ILT_start()
+#define IRQ_LATENCY_STOP(site)          ILT_stop(site)
+#else
+#define IRQ_LATENCY_START()             do { } while (0)
+#define IRQ_LATENCY_STOP(site)          do { } while (0)
+#endif
+
+/**
+ * @brief Flash Constant Tables
+ * @note FLASH_CONST places a constant table in the program memory, so it is not copied to SRAM at startup, and its
+ * entries must be read by FLASH_READ_BYTE or FLASH_READ_WORD with their address (e.g. FLASH_READ_WORD(&table[index])).
+ * @note On host (HOST_SIM build), the tables are normal constants and they are read directly.
+ */
+#if defined(HOST_SIM)
+#define FLASH_CONST
+#define FLASH_READ_BYTE(address)    (*((const uint8_t *)(address)))
+#define FLASH_READ_WORD(address)    (*((const uint16_t *)(address)))
+#else
+#define FLASH_CONST                 __attribute__((__progmem__))
+#define FLASH_READ_BYTE(address)    (__extension__({ uint16_t flash_address = (uint16_t)(uintptr_t)(address);         \
+                                                     uint8_t flash_byte;                                               \
+                                                     __asm__ __volatile__ ("lpm %0, Z" "\n\t"                          \
+                                                                           : "=r" (flash_byte) : "z" (flash_address)); \
+                                                     flash_byte; }))
+#define FLASH_READ_WORD(address)    (__extension__({ uint16_t flash_address = (uint16_t)(uintptr_t)(address);         \
+                                                     uint16_t flash_word;                                              \
+                                                     __asm__ __volatile__ ("lpm %A0, Z+" "\n\t" "lpm %B0, Z" "\n\t"  \
+                                                                           : "=r" (flash_word), "=z" (flash_address)   \
+                                                                           : "1" (flash_address));                     \
+                                                     flash_word; }))
+#endif
+
 /**
  * @brief NULL Pointer
  */
@@ -75,6 +141,35 @@ typedef enum
     EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN,
     EEPROM_DATA_IS_READ,
     EEPROM_DATA_IS_NOT_COMPLETELY_READ,
+    EEPROM_DATA_IS_QUEUED,
+    EEPROM_QUEUE_IS_FULL,
+    EEPROM_ADDRESS_IS_NOT_CACHED,
+    EEPROM_CRC_MISMATCH,
+
+    /* Benchmark Status */
+    BENCH_BUDGET_EXCEEDED,
+
+    /* Logic Capture Status */
+    LCAP_BUFFER_IS_FULL,
+    LCAP_SAMPLE_RATE_MISSED,
+
+    /* Scheduler Status */
+    SCH_TASKS_ARE_FULL,
+    SCH_TASK_OVERRUN,
+
+    /* Record Store Status */
+    REC_NO_RECORD_IS_STORED,
+
+    /* Configuration Bank Status */
+    CB_BANK_IS_NOT_VERIFIED,
+
+    /* Key-Value Store Status */
+    KV_KEY_IS_NOT_FOUND,
+    KV_KEYS_ARE_FULL,
+    KV_LOG_IS_FULL,
+
+    /* Stack Monitor Status */
+    STK_STACK_OVERFLOW,
 
     DRIVER_MAX_STATUS
 } driver_status_t;
@@ -0,0 +1,189 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 21:40:12                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:35:00                              *
+ * @FilePath              : BENCH_main.c                                     *
+ ****************************************************************************/
+
+/**
+ * @brief Benchmark Runner
+ * @note It runs BENCH_run and prints one line per API then "BENCH PASS" or "BENCH FAIL".
+ * @note On Atmega32 (make bench), the lines are written to the simavr console register and the MCU is stopped by
+ * sleeping with Global Interrupt disabled, which ends the simulation. On host (make bench-host), they are printed
+ * to stdout and the exit code is not zero if the benchmark fails.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/ModeManager/MM_int.h"
+#include "../Atmega32/Benchmark/BENCH_int.h"
+
+#if defined(HOST_SIM)
+#include <stdio.h>
+#else
+#include <avr_mcu_section.h>
+#endif
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Console
+ * @note The simavr console register is Timer/Counter2 Output Compare Register (OCR2), Timer/Counter2 is not used by
+ * the benchmark. simavr prints a console line when it receives a carriage return.
+ */
+#if defined(HOST_SIM)
+#define BENCH_PUTC(character)       ((void)putchar(character))
+#define BENCH_NEW_LINE              '\n'
+#else
+#define BENCH_CONSOLE_ADDRESS       0x43U
+#define BENCH_PUTC(character)       ((*(volatile uint8_t *)BENCH_CONSOLE_ADDRESS) = (uint8_t)(character))
+#define BENCH_NEW_LINE              '\r'
+
+AVR_MCU(F_CPU, "atmega32");
+AVR_MCU_SIMAVR_CONSOLE(BENCH_CONSOLE_ADDRESS);
+#endif
+
+/**
+ * @brief Maximum size of the name of a benchmarked API (including the null character)
+ */
+#define BENCH_NAME_SIZE             24U
+
+/**
+ * @brief Maximum number of decimal digits of a uint16_t
+ */
+#define BENCH_MAX_DIGITS            5U
+#define BENCH_DECIMAL_BASE          10U
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Names of the benchmarked APIs (same order as bench_api_t).
+ */
+static const char BENCH_names[BENCH_MAX_API][BENCH_NAME_SIZE] FLASH_CONST =
+{
+    "GPIO_set_pin_level",
+    "GPIO_get_pin_level",
+    "GPIO_tog_pin_level",
+    "GPIO_set_pin_level_fast",
+    "GPIO_get_pin_level_fast",
+    "GPIO_tog_pin_level_fast",
+    "EEPROM_read_data",
+    "MM_set_mode"
+};
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to print a string from RAM.
+ * @param string The null terminated string.
+ */
+static void BENCH_print_string(const char * string)
+{
+    while (*string != '\0')
+    {
+        BENCH_PUTC(*string);
+        string++;
+    }
+}
+
+/**
+ * @brief This function is used to print a string from flash.
+ * @param string The null terminated string in flash.
+ */
+static void BENCH_print_flash_string(const char * string)
+{
+    char character = (char)FLASH_READ_BYTE(string);
+
+    while (character != '\0')
+    {
+        BENCH_PUTC(character);
+        string++;
+        character = (char)FLASH_READ_BYTE(string);
+    }
+}
+
+/**
+ * @brief This function is used to print a number in decimal.
+ * @param number The number.
+ */
+static void BENCH_print_number(uint16_t number)
+{
+    char digits[BENCH_MAX_DIGITS];
+    uint8_t count = 0U;
+
+    /* Get the digits from the least significant one */
+    do
+    {
+        digits[count] = (char)('0' + (number % BENCH_DECIMAL_BASE));
+        number = (uint16_t)(number / BENCH_DECIMAL_BASE);
+        count++;
+    } while (number != 0U);
+
+    /* Print them from the most significant one */
+    while (count != 0U)
+    {
+        count--;
+        BENCH_PUTC(digits[count]);
+    }
+}
+
+
+/**
+ * @section Implementation
+ */
+
+int main(void)
+{
+    driver_status_t BENCH_status = DRIVER_IS_OK;
+    bench_result_t result;
+    uint8_t api = 0U;
+
+    BENCH_status = BENCH_run();
+
+    /* Print the result of each API */
+    for (api = 0U; api < BENCH_MAX_API; api++)
+    {
+        (void)BENCH_get_result((bench_api_t)api, &result);
+
+        BENCH_print_string("BENCH ");
+        BENCH_print_flash_string(BENCH_names[api]);
+        BENCH_print_string(" min=");
+        BENCH_print_number(result.min_cycles);
+        BENCH_print_string(" max=");
+        BENCH_print_number(result.max_cycles);
+        BENCH_print_string(" avg=");
+        BENCH_print_number(result.average_cycles);
+        BENCH_print_string(" budget=");
+        BENCH_print_number(result.budget_cycles);
+        BENCH_print_string((result.status == DRIVER_IS_OK) ? " ok" : " EXCEEDED");
+        BENCH_PUTC(BENCH_NEW_LINE);
+    }
+
+    /* Print the verdict */
+    BENCH_print_string((BENCH_status == DRIVER_IS_OK) ? "BENCH PASS" : "BENCH FAIL");
+    BENCH_PUTC(BENCH_NEW_LINE);
+
+#if defined(HOST_SIM)
+    return (BENCH_status == DRIVER_IS_OK) ? 0 : 1;
+#else
+    /* Stop the simulation (sleeping with Global Interrupt disabled) */
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    while (1)
+    {
+        (void)MM_set_mode(PWR_DOWN_MODE);
+    }
+#endif
+}
@@ -0,0 +1,152 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:18:00                              *
+ * @FilePath              : TEST_cb.c                                        *
+ ****************************************************************************/
+
+/**
+ * @brief Configuration Bank Tests
+ */
+
+/**
+ * @section Includes
+ */
+
+#include <string.h>
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/EEPROM/EEPROM_int.h"
+#include "../Atmega32/ConfigBank/CB_int.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+#define TEST_CB_BASE_ADDRESS        100U
+#define TEST_CB_BLOCK_SIZE          60U
+
+/**
+ * @brief Value of the commit byte whose write has been interrupted (neither bank A nor bank B)
+ */
+#define TEST_CB_TORN_COMMIT         0x13U
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to commit a block until it is completely written.
+ * @param programmed_bytes A pointer to the number of EEPROM bytes programmed by the commit.
+ * @note The programmed bytes counted by the bank are checked against the simulated EEPROM writes.
+ */
+static driver_status_t TEST_cb_commit(cb_bank_t * bank, uint8_t * data, uint32_t * programmed_bytes)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t writes = SIM_get_eeprom_writes();
+    uint32_t counted = bank->programmed_bytes;
+    uint32_t calls = 0U;
+
+    do
+    {
+        status = CB_commit(bank, data);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+
+    *programmed_bytes = SIM_get_eeprom_writes() - writes;
+    TEST_CHECK((bank->programmed_bytes - counted) == *programmed_bytes);
+
+    return status;
+}
+
+/**
+ * @brief It tests the commits, the programmed bytes of each one and the reopening of the bank.
+ */
+static void TEST_cb_commits(void)
+{
+    cb_bank_t bank;
+    cb_bank_t reopened;
+    uint8_t data[TEST_CB_BLOCK_SIZE] = {0U};
+    uint8_t read[TEST_CB_BLOCK_SIZE] = {0U};
+    uint32_t programmed_bytes = 0U;
+    uint8_t index = 0U;
+
+    for (index = 0U; index < TEST_CB_BLOCK_SIZE; index++)
+    {
+        data[index] = index;
+    }
+
+    /* An erased region is bank A */
+    TEST_CHECK(CB_init(&bank, TEST_CB_BASE_ADDRESS, TEST_CB_BLOCK_SIZE) == DRIVER_IS_OK);
+    TEST_CHECK(bank.active_bank == 0U);
+
+    /* First commit goes to bank B (whole block and commit byte) */
+    TEST_CHECK(TEST_cb_commit(&bank, data, &programmed_bytes) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(bank.active_bank == 1U);
+    TEST_CHECK(programmed_bytes == (TEST_CB_BLOCK_SIZE + 1U));
+
+    /* Second commit goes to the erased bank A */
+    data[5] = 99U;
+    TEST_CHECK(TEST_cb_commit(&bank, data, &programmed_bytes) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(bank.active_bank == 0U);
+    TEST_CHECK(programmed_bytes == (TEST_CB_BLOCK_SIZE + 1U));
+
+    /* Third commit programs only the bytes which differ from the first configuration */
+    data[7] = 77U;
+    TEST_CHECK(TEST_cb_commit(&bank, data, &programmed_bytes) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(bank.active_bank == 1U);
+    TEST_CHECK(programmed_bytes == 3U);
+
+    /* Same configuration programs nothing */
+    TEST_CHECK(TEST_cb_commit(&bank, data, &programmed_bytes) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(programmed_bytes == 0U);
+
+    /* Reopened bank (as after a reset) */
+    TEST_CHECK(CB_init(&reopened, TEST_CB_BASE_ADDRESS, TEST_CB_BLOCK_SIZE) == DRIVER_IS_OK);
+    TEST_CHECK(reopened.active_bank == 1U);
+    TEST_CHECK(CB_read(&reopened, read) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(memcmp(data, read, TEST_CB_BLOCK_SIZE) == 0);
+
+    /* A torn commit byte selects bank A which holds the previous configuration */
+    SIM_eeprom_poke(TEST_CB_BASE_ADDRESS, TEST_CB_TORN_COMMIT);
+    TEST_CHECK(CB_init(&reopened, TEST_CB_BASE_ADDRESS, TEST_CB_BLOCK_SIZE) == DRIVER_IS_OK);
+    TEST_CHECK(reopened.active_bank == 0U);
+    TEST_CHECK(CB_read(&reopened, read) == EEPROM_DATA_IS_READ);
+    TEST_CHECK((read[5] == 99U) && (read[7] == 7U));
+}
+
+/**
+ * @brief It tests the invalid arguments.
+ */
+static void TEST_cb_arguments(void)
+{
+    cb_bank_t bank;
+    uint8_t data[1] = {0U};
+
+    TEST_CHECK(CB_init(&bank, 1000U, TEST_CB_BLOCK_SIZE) == EEPROM_ADDRESS_NOT_AVAILABLE);
+    TEST_CHECK(CB_init(&bank, 0U, 0U) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(CB_init(NULL_PTR, 0U, TEST_CB_BLOCK_SIZE) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(CB_read(&bank, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(CB_commit(NULL_PTR, data) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Configuration Bank Test Suite
+ */
+void TEST_cb(void)
+{
+    SIM_reset();
+    (void)EEPROM_init();
+
+    TEST_cb_commits();
+    TEST_cb_arguments();
+}
@@ -0,0 +1,143 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 01:43:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 01:43:00                              *
+ * @FilePath              : TEST_deb.c                                       *
+ ****************************************************************************/
+
+/**
+ * @brief Debouncer Tests
+ * @note The pins of PORT_C are floating inputs whose levels are driven by SIM_drive_pins before each sample.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/GPIO/GPIO_int.h"
+#include "../Atmega32/Debounce/DEB_int.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Port index of PORT_C in the simulator
+ */
+#define TEST_SIM_PORT_C             2U
+
+/**
+ * @brief Number of successive samples which change a debounced level
+ */
+#define TEST_DEB_SAMPLES            4U
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to drive the levels of PORT_C pins then sample them once.
+ */
+static void TEST_deb_sample(uint8_t levels)
+{
+    (void)SIM_drive_pins(TEST_SIM_PORT_C, PIN_ALL, levels);
+    (void)DEB_update();
+}
+
+/**
+ * @brief This function is used to get the debounced levels of PORT_C pins.
+ */
+static uint8_t TEST_deb_state(void)
+{
+    uint8_t state = 0U;
+
+    (void)DEB_get_state(PORT_C, &state);
+
+    return state;
+}
+
+/**
+ * @brief It tests the debounce time, the edges and the pins which are debounced in parallel.
+ */
+static void TEST_deb_levels(void)
+{
+    uint8_t rising = 0U;
+    uint8_t falling = 0U;
+    uint8_t sample = 0U;
+    uint8_t early_changes = 0U;
+
+    (void)GPIO_set_pin_mode(PORT_C, PIN_ALL, PIN_FLOATING_INPUT);
+    (void)SIM_drive_pins(TEST_SIM_PORT_C, PIN_ALL, PIN_1);
+    TEST_CHECK(DEB_init() == DRIVER_IS_OK);
+    TEST_CHECK(TEST_deb_state() == PIN_1);
+
+    /* PIN_0 goes high, it changes at the fourth sample only */
+    for (sample = 1U; sample < TEST_DEB_SAMPLES; sample++)
+    {
+        TEST_deb_sample(PIN_0 | PIN_1);
+        early_changes += (TEST_deb_state() != PIN_1) ? 1U : 0U;
+    }
+    TEST_CHECK(early_changes == 0U);
+    TEST_deb_sample(PIN_0 | PIN_1);
+    TEST_CHECK(TEST_deb_state() == (PIN_0 | PIN_1));
+
+    /* A bouncing pin keeps its debounced level */
+    for (sample = 0U; sample < (4U * TEST_DEB_SAMPLES); sample++)
+    {
+        TEST_deb_sample((uint8_t)(PIN_0 | PIN_1 | (((sample % TEST_DEB_SAMPLES) < 3U) ? PIN_2 : 0U)));
+    }
+    TEST_CHECK(TEST_deb_state() == (PIN_0 | PIN_1));
+
+    /* PIN_1 goes low two samples before PIN_3 goes high, each one changes after its own 4 samples */
+    TEST_deb_sample(PIN_0);
+    TEST_deb_sample(PIN_0);
+    TEST_deb_sample(PIN_0 | PIN_3);
+    TEST_deb_sample(PIN_0 | PIN_3);
+    TEST_CHECK(TEST_deb_state() == PIN_0);
+    TEST_deb_sample(PIN_0 | PIN_3);
+    TEST_CHECK(TEST_deb_state() == PIN_0);
+    TEST_deb_sample(PIN_0 | PIN_3);
+    TEST_CHECK(TEST_deb_state() == (PIN_0 | PIN_3));
+
+    /* The edges are accumulated since the last read, then cleared */
+    TEST_CHECK(DEB_get_edges(PORT_C, &rising, &falling) == DRIVER_IS_OK);
+    TEST_CHECK((rising == (PIN_0 | PIN_3)) && (falling == PIN_1));
+    TEST_CHECK(DEB_get_edges(PORT_C, &rising, &falling) == DRIVER_IS_OK);
+    TEST_CHECK((rising == 0U) && (falling == 0U));
+
+    (void)SIM_release_pins(TEST_SIM_PORT_C, PIN_ALL);
+}
+
+/**
+ * @brief It tests the invalid arguments.
+ */
+static void TEST_deb_arguments(void)
+{
+    uint8_t state = 0U;
+
+    TEST_CHECK(DEB_get_state(PORT_MAX, &state) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(DEB_get_state(PORT_A, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(DEB_get_edges(PORT_MAX, &state, &state) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(DEB_get_edges(PORT_A, &state, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Debouncer Test Suite
+ */
+void TEST_deb(void)
+{
+    SIM_reset();
+
+    TEST_deb_levels();
+    TEST_deb_arguments();
+}
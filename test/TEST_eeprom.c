@@ -0,0 +1,659 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:25:00                              *
+ * @FilePath              : TEST_eeprom.c                                    *
+ ****************************************************************************/
+
+/**
+ * @brief EEPROM Driver Tests
+ * @note The asynchronous queue, cache and coalescing tests are built only in the configurations which enable them.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include <string.h>
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/EEPROM/EEPROM_int.h"
+#include "../Atmega32/EEPROM/EEPROM_priv.h"
+#include "../Atmega32/EEPROM/EEPROM_cfg.h"
+#include "../Atmega32/ModeManager/MM_int.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief CRC-16/CCITT-FALSE of "123456789" (the standard check value)
+ */
+#define TEST_CRC_CHECK_VALUE        0x29B1U
+#define TEST_CRC_POLYNOMIAL         0x1021U
+#define TEST_CRC_TOP_BIT            0x8000U
+
+#define TEST_BLOCK_SIZE             20U
+#define TEST_LONG_READ_SIZE         300U
+
+/**
+ * @brief Update of a block while the asynchronous queue writes another block
+ */
+#define TEST_RACE_SIZE              32U
+#define TEST_RACE_QUEUE_ADDRESS     600U
+#define TEST_RACE_UPDATE_ADDRESS    700U
+#define TEST_RACE_QUEUED_BYTE       0x33U
+#define TEST_RACE_STORED_BYTE       0x44U
+#define TEST_ERASED_BYTE            0xFFU
+
+/**
+ * @brief Block written while EEPROM_WAIT_SLEEP sleeps between its bytes
+ */
+#define TEST_SLEEP_SIZE             4U
+#define TEST_SLEEP_ADDRESS          800U
+
+
+/**
+ * @section Global Variables
+ */
+
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+static uint8_t TEST_callbacks = 0U;
+static uint8_t TEST_chained_data[3] = {9U, 8U, 7U};
+static driver_status_t TEST_chained_status = DRIVER_IS_OK;
+#endif
+
+#if EEPROM_WAIT_MODE == EEPROM_WAIT_SLEEP
+static uint32_t TEST_sleeps = 0U;
+static uint8_t TEST_sleep_mode = 0U;
+#endif
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to get the expected byte of the test pattern at an EEPROM address.
+ */
+static uint8_t TEST_pattern(uint16_t address)
+{
+    return (uint8_t)((address * 13U) + (address / 256U));
+}
+
+/**
+ * @brief This function is used to compute CRC-16/CCITT-FALSE bit by bit (reference of EEPROM_crc16_update).
+ */
+static uint16_t TEST_crc16_reference(const uint8_t * data, uint16_t length)
+{
+    uint16_t crc = 0xFFFFU;
+    uint16_t index = 0U;
+    uint8_t bit = 0U;
+
+    for (index = 0U; index < length; index++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[index] << 8U);
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & TEST_CRC_TOP_BIT) != 0U) ? (uint16_t)((crc << 1U) ^ TEST_CRC_POLYNOMIAL) : (uint16_t)(crc << 1U);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief This function is used to write data until it is completely written (or the calls limit is reached).
+ */
+static driver_status_t TEST_write(uint16_t address, uint8_t * data, uint16_t length, uint16_t * actual_length)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t calls = 0U;
+
+    *actual_length = 0U;
+    do
+    {
+        status = EEPROM_write_data(address, data, length, actual_length);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (*actual_length < length) && (calls < TEST_MAX_CALLS) &&
+             ((address + *actual_length) <= EEPROM_LAST_LOCATION));
+
+    return status;
+}
+
+/**
+ * @brief This function is used to read data until it is completely read (or the calls limit is reached).
+ */
+static driver_status_t TEST_read(uint16_t address, uint8_t * data, uint16_t length, uint16_t * actual_length)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t calls = 0U;
+
+    *actual_length = 0U;
+    do
+    {
+        status = EEPROM_read_data(address, data, length, actual_length);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_READ) && (calls < TEST_MAX_CALLS));
+
+    return status;
+}
+
+/**
+ * @brief This function is used to update data until it is completely written (or the calls limit is reached).
+ */
+static driver_status_t TEST_update(uint16_t address, uint8_t * data, uint16_t length, uint16_t * programmed_length)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint16_t actual_length = 0U;
+    uint32_t calls = 0U;
+
+    do
+    {
+        status = EEPROM_update_data(address, data, length, &actual_length, programmed_length);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+
+    return status;
+}
+
+/**
+ * @brief It tests writing and reading successive bytes, the end of EEPROM Space and the invalid arguments.
+ */
+static void TEST_eeprom_write_read(void)
+{
+    uint8_t data[8] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    uint8_t read[8] = {0U};
+    uint16_t actual_length = 0U;
+
+    TEST_CHECK(TEST_write(10U, data, 8U, &actual_length) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(actual_length == 8U);
+    TEST_CHECK(SIM_eeprom_peek(17U) == 8U);
+
+    TEST_CHECK(TEST_read(10U, read, 8U, &actual_length) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(memcmp(data, read, 8U) == 0);
+
+    TEST_CHECK(EEPROM_write_byte(100U, 0x5AU) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(SIM_eeprom_peek(100U) == 0x5AU);
+
+    /* Only the bytes in EEPROM Space are written */
+    (void)TEST_write(1020U, data, 8U, &actual_length);
+    TEST_CHECK(actual_length == 4U);
+    TEST_CHECK(SIM_eeprom_peek(EEPROM_LAST_LOCATION) == 4U);
+
+    actual_length = 0U;
+    TEST_CHECK(EEPROM_write_data(1024U, data, 8U, &actual_length) == EEPROM_ADDRESS_NOT_AVAILABLE);
+    TEST_CHECK(EEPROM_read_data(10U, NULL_PTR, 8U, &actual_length) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(EEPROM_write_data(10U, data, 8U, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+/**
+ * @brief It tests a long read (several read budgets, across a 256 bytes boundary) and EEPROM_read_bytes.
+ */
+static void TEST_eeprom_long_read(void)
+{
+    uint8_t read[TEST_LONG_READ_SIZE] = {0U};
+    uint16_t actual_length = 0U;
+    uint16_t address = 0U;
+    uint16_t mismatches = 0U;
+
+    for (address = 0U; address <= EEPROM_LAST_LOCATION; address++)
+    {
+        SIM_eeprom_poke(address, TEST_pattern(address));
+    }
+
+    TEST_CHECK(TEST_read(200U, read, TEST_LONG_READ_SIZE, &actual_length) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(actual_length == TEST_LONG_READ_SIZE);
+    for (address = 0U; address < TEST_LONG_READ_SIZE; address++)
+    {
+        mismatches += (read[address] != TEST_pattern((uint16_t)(200U + address))) ? 1U : 0U;
+    }
+    TEST_CHECK(mismatches == 0U);
+
+    (void)memset(read, 0, sizeof(read));
+    mismatches = 0U;
+    TEST_CHECK(EEPROM_read_bytes(900U, read, 124U) == EEPROM_DATA_IS_READ);
+    for (address = 0U; address < 124U; address++)
+    {
+        mismatches += (read[address] != TEST_pattern((uint16_t)(900U + address))) ? 1U : 0U;
+    }
+    TEST_CHECK(mismatches == 0U);
+    TEST_CHECK(EEPROM_read_bytes(1000U, read, 25U) == EEPROM_ADDRESS_NOT_AVAILABLE);
+}
+
+/**
+ * @brief It tests that EEPROM_update_data programs only the changed bytes and resets the programmed length.
+ */
+static void TEST_eeprom_update(void)
+{
+    uint8_t data[16] = {0U};
+    uint8_t read[16] = {0U};
+    uint16_t actual_length = 0U;
+    uint16_t programmed_length = 0U;
+    uint32_t writes = 0U;
+    uint8_t index = 0U;
+
+    for (index = 0U; index < 16U; index++)
+    {
+        data[index] = (uint8_t)(index + 0x40U);
+    }
+    (void)TEST_write(300U, data, 16U, &actual_length);
+
+    /* Nothing changed */
+    writes = SIM_get_eeprom_writes();
+    programmed_length = 99U;
+    TEST_CHECK(TEST_update(300U, data, 16U, &programmed_length) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(programmed_length == 0U);
+    TEST_CHECK(SIM_get_eeprom_writes() == writes);
+
+    /* Three bytes changed */
+    data[0] = 0x00U;
+    data[7] = 0x77U;
+    data[15] = 0xFFU;
+    writes = SIM_get_eeprom_writes();
+    TEST_CHECK(TEST_update(300U, data, 16U, &programmed_length) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(programmed_length == 3U);
+    TEST_CHECK(SIM_get_eeprom_writes() == (writes + 3U));
+    TEST_CHECK(TEST_read(300U, read, 16U, &actual_length) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(memcmp(data, read, 16U) == 0);
+
+    actual_length = 0U;
+    TEST_CHECK(EEPROM_update_data(1024U, data, 16U, &actual_length, &programmed_length) == EEPROM_ADDRESS_NOT_AVAILABLE);
+    TEST_CHECK(EEPROM_update_data(300U, data, 16U, &actual_length, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+/**
+ * @brief It tests the CRC-16 against its check value and the CRC protected blocks.
+ */
+static void TEST_eeprom_crc(void)
+{
+    uint8_t check[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    uint8_t data[TEST_BLOCK_SIZE] = {0U};
+    uint8_t read[TEST_BLOCK_SIZE] = {0U};
+    eeprom_xfer_t xfer;
+    driver_status_t status = DRIVER_IS_OK;
+    uint16_t crc = 0xFFFFU;
+    uint32_t calls = 0U;
+    uint8_t index = 0U;
+
+    TEST_CHECK(EEPROM_crc16_update(&crc, check, 9U) == DRIVER_IS_OK);
+    TEST_CHECK(crc == TEST_CRC_CHECK_VALUE);
+    TEST_CHECK(EEPROM_crc16_update(NULL_PTR, check, 9U) == PTR_USED_IS_NULL_PTR);
+
+    for (index = 0U; index < TEST_BLOCK_SIZE; index++)
+    {
+        data[index] = (uint8_t)(index * 7U);
+    }
+
+    /* The block crosses a 256 bytes boundary */
+    (void)EEPROM_xfer_init(&xfer, 245U, data, TEST_BLOCK_SIZE);
+    do
+    {
+        status = EEPROM_write_block_crc(&xfer);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+    TEST_CHECK(status == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(xfer.crc == TEST_crc16_reference(data, TEST_BLOCK_SIZE));
+
+    (void)EEPROM_xfer_init(&xfer, 245U, read, TEST_BLOCK_SIZE);
+    do
+    {
+        status = EEPROM_read_block_crc(&xfer);
+    } while (status == EEPROM_DATA_IS_NOT_COMPLETELY_READ);
+    TEST_CHECK(status == EEPROM_DATA_IS_READ);
+    TEST_CHECK(memcmp(data, read, TEST_BLOCK_SIZE) == 0);
+
+    /* One flipped bit is detected */
+    SIM_eeprom_poke(250U, (uint8_t)(SIM_eeprom_peek(250U) ^ 0x04U));
+    (void)EEPROM_xfer_init(&xfer, 245U, read, TEST_BLOCK_SIZE);
+    do
+    {
+        status = EEPROM_read_block_crc(&xfer);
+    } while (status == EEPROM_DATA_IS_NOT_COMPLETELY_READ);
+    TEST_CHECK(status == EEPROM_CRC_MISMATCH);
+
+    /* The block and its CRC must be in EEPROM Space */
+    (void)EEPROM_xfer_init(&xfer, 1010U, read, TEST_BLOCK_SIZE);
+    TEST_CHECK(EEPROM_read_block_crc(&xfer) == EEPROM_ADDRESS_NOT_AVAILABLE);
+}
+
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+/**
+ * @brief Callback of the asynchronous tests.
+ */
+static void TEST_callback(void)
+{
+    TEST_callbacks++;
+}
+
+/**
+ * @brief Callback of the asynchronous tests which chains a second request from EEPROM Ready Interrupt.
+ */
+static void TEST_chaining_callback(void)
+{
+    TEST_callbacks++;
+    TEST_chained_status = EEPROM_write_async(10U, TEST_chained_data, 3U, TEST_callback);
+}
+
+/**
+ * @brief This function is used to let the queue drain (reading a block meanwhile if it is requested).
+ */
+static void TEST_drain_queue(uint8_t read_meanwhile)
+{
+    uint8_t depth = 0U;
+    uint8_t read[4] = {0U};
+    uint16_t actual_length = 0U;
+    uint32_t calls = 0U;
+
+    do
+    {
+        SIM_advance(TEST_STEP_CYCLES);
+        if (read_meanwhile == SET_VALUE)
+        {
+            (void)TEST_read(50U, read, 4U, &actual_length);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        (void)EEPROM_get_queue_depth(&depth);
+        calls++;
+    } while (((depth != 0U) || ((((EEPROM->EECR).bits).EERIE) != 0U)) && (calls < TEST_MAX_CALLS));
+}
+
+/**
+ * @brief It tests the asynchronous write queue, its limits and its interaction with the blocking APIs.
+ */
+static void TEST_eeprom_queue(void)
+{
+    uint8_t data[EEPROM_ASYNC_QUEUE_SIZE + 1U] = {1U, 2U, 3U, 4U};
+    uint8_t depth = 0U;
+    uint8_t index = 0U;
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+
+    /* One request with its callback */
+    TEST_callbacks = 0U;
+    TEST_CHECK(EEPROM_write_async(0U, data, 4U, TEST_callback) == EEPROM_DATA_IS_QUEUED);
+    TEST_CHECK((EEPROM_get_queue_depth(&depth) == DRIVER_IS_OK) && (depth != 0U));
+    TEST_drain_queue(CLEAR_VALUE);
+    TEST_CHECK(TEST_callbacks == 1U);
+    TEST_CHECK((SIM_eeprom_peek(0U) == 1U) && (SIM_eeprom_peek(3U) == 4U));
+    TEST_CHECK((((EEPROM->EECR).bits).EERIE) == 0U);
+
+    /* Limits */
+    TEST_CHECK(EEPROM_write_async(0U, data, EEPROM_ASYNC_QUEUE_SIZE + 1U, NULL_PTR) == EEPROM_QUEUE_IS_FULL);
+    TEST_CHECK(EEPROM_write_async(0U, data, 0U, NULL_PTR) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(EEPROM_write_async(1020U, data, 5U, NULL_PTR) == EEPROM_ADDRESS_NOT_AVAILABLE);
+    TEST_CHECK(EEPROM_write_async(0U, NULL_PTR, 1U, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    for (index = 0U; index < EEPROM_ASYNC_REQUESTS_SIZE; index++)
+    {
+        TEST_CHECK(EEPROM_write_async((uint16_t)(20U + index), data, 1U, NULL_PTR) == EEPROM_DATA_IS_QUEUED);
+    }
+    TEST_CHECK(EEPROM_write_async(30U, data, 1U, NULL_PTR) == EEPROM_QUEUE_IS_FULL);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    TEST_drain_queue(CLEAR_VALUE);
+
+    /* A blocking write with Interrupts disabled must not leave EEPROM Ready Interrupt disabled under the queue */
+    TEST_callbacks = 0U;
+    data[0] = 0x11U;
+    TEST_CHECK(EEPROM_write_async(0U, data, 4U, TEST_callback) == EEPROM_DATA_IS_QUEUED);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    while (EEPROM_write_byte(100U, 7U) != EEPROM_DATA_IS_WRITTEN)
+    {
+        SIM_advance(TEST_STEP_CYCLES);
+    }
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    TEST_drain_queue(CLEAR_VALUE);
+    TEST_CHECK(TEST_callbacks == 1U);
+    TEST_CHECK((SIM_eeprom_peek(0U) == 0x11U) && (SIM_eeprom_peek(3U) == 4U) && (SIM_eeprom_peek(100U) == 7U));
+
+    /* A callback chains a request while block reads run */
+    TEST_callbacks = 0U;
+    data[0] = 0x22U;
+    TEST_CHECK(EEPROM_write_async(0U, data, 4U, TEST_chaining_callback) == EEPROM_DATA_IS_QUEUED);
+    TEST_drain_queue(SET_VALUE);
+    TEST_CHECK(TEST_chained_status == EEPROM_DATA_IS_QUEUED);
+    TEST_CHECK(TEST_callbacks == 2U);
+    TEST_CHECK((SIM_eeprom_peek(0U) == 0x22U) && (SIM_eeprom_peek(10U) == 9U) && (SIM_eeprom_peek(12U) == 7U));
+    TEST_CHECK((((EEPROM->EECR).bits).EERIE) == 0U);
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+}
+
+/**
+ * @brief It tests EEPROM_update_data while the queue drains, EEPROM Ready Interrupt is delayed by one access so it
+ * starts a queued byte right after the driver has seen EEPROM ready (EEAR and EERE are ignored while EEWE is set).
+ */
+static void TEST_eeprom_update_while_draining(void)
+{
+    uint8_t queued[TEST_RACE_SIZE] = {0U};
+    uint8_t data[TEST_RACE_SIZE] = {0U};
+    uint16_t programmed_length = 0U;
+    uint32_t writes = 0U;
+    uint8_t mismatches = 0U;
+    uint8_t index = 0U;
+
+    /* The first half is erased and differs from the data, the second half already holds it */
+    for (index = 0U; index < TEST_RACE_SIZE; index++)
+    {
+        queued[index] = TEST_RACE_QUEUED_BYTE;
+        data[index] = (index < (TEST_RACE_SIZE / 2U)) ? TEST_RACE_QUEUED_BYTE : TEST_RACE_STORED_BYTE;
+        SIM_eeprom_poke((uint16_t)(TEST_RACE_UPDATE_ADDRESS + index),
+                        (index < (TEST_RACE_SIZE / 2U)) ? TEST_ERASED_BYTE : TEST_RACE_STORED_BYTE);
+    }
+
+    SIM_set_eeprom_ready_delay(1U);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    writes = SIM_get_eeprom_writes();
+
+    TEST_CHECK(EEPROM_write_async(TEST_RACE_QUEUE_ADDRESS, queued, TEST_RACE_SIZE, NULL_PTR) == EEPROM_DATA_IS_QUEUED);
+    TEST_CHECK(TEST_update(TEST_RACE_UPDATE_ADDRESS, data, TEST_RACE_SIZE, &programmed_length) == EEPROM_DATA_IS_WRITTEN);
+    TEST_drain_queue(CLEAR_VALUE);
+
+    for (index = 0U; index < TEST_RACE_SIZE; index++)
+    {
+        mismatches += (SIM_eeprom_peek((uint16_t)(TEST_RACE_UPDATE_ADDRESS + index)) != data[index]) ? 1U : 0U;
+    }
+    TEST_CHECK(mismatches == 0U);
+    TEST_CHECK(programmed_length == (TEST_RACE_SIZE / 2U));
+    TEST_CHECK(SIM_get_eeprom_writes() == (writes + TEST_RACE_SIZE + (TEST_RACE_SIZE / 2U)));
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    SIM_set_eeprom_ready_delay(0U);
+}
+#endif
+
+#if EEPROM_CACHE == EEPROM_CACHE_ENABLE
+/**
+ * @brief It tests the cache window and its write back (only the changed bytes are programmed).
+ */
+static void TEST_eeprom_cache(void)
+{
+    uint8_t data[3] = {9U, 2U, 9U};
+    uint8_t read[3] = {0U};
+    uint16_t actual_length = 0U;
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t writes = 0U;
+    uint32_t calls = 0U;
+
+    TEST_CHECK(EEPROM_cache_load() == EEPROM_DATA_IS_READ);
+    TEST_CHECK(EEPROM_cache_read(EEPROM_CACHE_BASE_ADDRESS + 10U, read, 3U) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(read[2] == SIM_eeprom_peek(EEPROM_CACHE_BASE_ADDRESS + 12U));
+    TEST_CHECK(EEPROM_cache_read(EEPROM_CACHE_BASE_ADDRESS + EEPROM_CACHE_SIZE - 1U, read, 2U) == EEPROM_ADDRESS_IS_NOT_CACHED);
+    TEST_CHECK(EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + EEPROM_CACHE_SIZE, data, 1U) == EEPROM_ADDRESS_IS_NOT_CACHED);
+
+    /* Two bytes change (the middle one holds the same value), then one byte is changed and reverted */
+    (void)EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + 11U, &data[1], 1U);
+    TEST_CHECK(EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + 10U, data, 3U) == EEPROM_DATA_IS_QUEUED);
+    read[0] = (uint8_t)(SIM_eeprom_peek(EEPROM_CACHE_BASE_ADDRESS + 40U) ^ 0xAAU);
+    (void)EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + 40U, read, 1U);
+    read[0] = SIM_eeprom_peek(EEPROM_CACHE_BASE_ADDRESS + 40U);
+    (void)EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + 40U, read, 1U);
+
+    writes = SIM_get_eeprom_writes();
+    do
+    {
+        status = EEPROM_cache_drain();
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status != EEPROM_DATA_IS_WRITTEN) && (calls < TEST_MAX_CALLS));
+    TEST_CHECK(SIM_get_eeprom_writes() <= (writes + 3U));
+    TEST_CHECK(TEST_read(EEPROM_CACHE_BASE_ADDRESS + 10U, read, 3U, &actual_length) == EEPROM_DATA_IS_READ);
+    TEST_CHECK(memcmp(data, read, 3U) == 0);
+
+    data[0] = 5U;
+    (void)EEPROM_cache_write(EEPROM_CACHE_BASE_ADDRESS + 20U, data, 1U);
+    calls = 0U;
+    do
+    {
+        status = EEPROM_flush();
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status != EEPROM_DATA_IS_WRITTEN) && (calls < TEST_MAX_CALLS));
+    TEST_CHECK(SIM_eeprom_peek(EEPROM_CACHE_BASE_ADDRESS + 20U) == 5U);
+}
+#endif
+
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+/**
+ * @brief It tests that repeated writes to the same addresses are coalesced in one program cycle per byte.
+ */
+static void TEST_eeprom_coalesce(void)
+{
+    uint8_t data[EEPROM_COALESCE_SIZE + 1U] = {0U};
+    uint8_t read[4] = {0U};
+    uint16_t actual_length = 0U;
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t writes = 0U;
+    uint32_t calls = 0U;
+    uint8_t index = 0U;
+
+    /* Make the bytes differ from the written values */
+    SIM_eeprom_poke(500U, 0xFFU);
+    SIM_eeprom_poke(501U, 0xFFU);
+
+    writes = SIM_get_eeprom_writes();
+    for (index = 0U; index < 100U; index++)
+    {
+        data[0] = index;
+        data[1] = (uint8_t)(index + 1U);
+        TEST_CHECK(EEPROM_write_pending(500U, data, 2U) == EEPROM_DATA_IS_QUEUED);
+    }
+    TEST_CHECK(SIM_get_eeprom_writes() == writes);
+
+    /* The pending bytes are seen by the reads */
+    TEST_CHECK(TEST_read(499U, read, 4U, &actual_length) == EEPROM_DATA_IS_READ);
+    TEST_CHECK((read[1] == 99U) && (read[2] == 100U));
+
+    do
+    {
+        status = EEPROM_process_pending();
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status != EEPROM_DATA_IS_WRITTEN) && (calls < TEST_MAX_CALLS));
+    TEST_CHECK(SIM_get_eeprom_writes() == (writes + 2U));
+    TEST_CHECK((SIM_eeprom_peek(500U) == 99U) && (SIM_eeprom_peek(501U) == 100U));
+
+    /* Capacity */
+    TEST_CHECK(EEPROM_write_pending(600U, data, EEPROM_COALESCE_SIZE + 1U) == EEPROM_QUEUE_IS_FULL);
+    TEST_CHECK(EEPROM_write_pending(600U, data, EEPROM_COALESCE_SIZE) == EEPROM_DATA_IS_QUEUED);
+    calls = 0U;
+    do
+    {
+        status = EEPROM_flush_pending();
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status != EEPROM_DATA_IS_WRITTEN) && (calls < TEST_MAX_CALLS));
+    TEST_CHECK(status == EEPROM_DATA_IS_WRITTEN);
+}
+#endif
+
+
+/**
+ * @section Implementation
+ */
+
+#if EEPROM_WAIT_MODE == EEPROM_WAIT_SLEEP
+/**
+ * @brief This function replaces the sleep instruction, it records the Sleep Mode and lets the time pass.
+ */
+static void TEST_sleep_hook(uint8_t mode)
+{
+    TEST_sleeps++;
+    TEST_sleep_mode = mode;
+    SIM_advance(TEST_STEP_CYCLES);
+}
+
+/**
+ * @brief It tests that the blocking write sleeps in Idle Mode until EEPROM is ready, and polls EEPROM if Global
+ * Interrupt is disabled by the caller.
+ */
+static void TEST_eeprom_sleep_wait(void)
+{
+    uint8_t data[TEST_SLEEP_SIZE] = {0x11U, 0x22U, 0x33U, 0x44U};
+    uint16_t actual_length = 0U;
+    uint32_t sleeps = 0U;
+
+    SIM_set_sleep_hook(TEST_sleep_hook);
+    TEST_sleeps = 0U;
+
+    /* The write waits for each previous byte in Idle Mode, and Global Interrupt stays enabled */
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    TEST_CHECK(EEPROM_write_data(TEST_SLEEP_ADDRESS, data, TEST_SLEEP_SIZE, &actual_length) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(actual_length == TEST_SLEEP_SIZE);
+    TEST_CHECK(TEST_sleeps >= (TEST_SLEEP_SIZE - 1U));
+    TEST_CHECK(TEST_sleep_mode == (uint8_t)IDLE_MODE);
+    TEST_CHECK(((SREG->bits).I) == GLOBAL_INTERRUPT_ENABLE);
+
+    /* Sleeping would enable Global Interrupt, so EEPROM is polled */
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    sleeps = TEST_sleeps;
+    actual_length = 0U;
+    TEST_CHECK(EEPROM_write_data(TEST_SLEEP_ADDRESS + TEST_SLEEP_SIZE, data, TEST_SLEEP_SIZE, &actual_length) ==
+               EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(actual_length == TEST_SLEEP_SIZE);
+    TEST_CHECK(TEST_sleeps == sleeps);
+    TEST_CHECK(((SREG->bits).I) == GLOBAL_INTERRUPT_DISABLE);
+
+    /* The bytes before the last one have been programmed before the write returned */
+    TEST_CHECK((SIM_eeprom_peek(TEST_SLEEP_ADDRESS + TEST_SLEEP_SIZE - 1U) == data[TEST_SLEEP_SIZE - 1U]) &&
+               (SIM_eeprom_peek(TEST_SLEEP_ADDRESS + (2U * TEST_SLEEP_SIZE) - 2U) == data[TEST_SLEEP_SIZE - 2U]));
+
+    SIM_set_sleep_hook(NULL_PTR);
+}
+#endif
+
+/**
+ * @brief EEPROM Test Suite
+ */
+void TEST_eeprom(void)
+{
+    SIM_reset();
+    (void)EEPROM_init();
+
+    TEST_eeprom_write_read();
+    TEST_eeprom_long_read();
+    TEST_eeprom_update();
+    TEST_eeprom_crc();
+#if EEPROM_INTERRUPT == EERPOM_INTERRUPT_ENABLE
+    TEST_eeprom_queue();
+    TEST_eeprom_update_while_draining();
+#endif
+#if EEPROM_CACHE == EEPROM_CACHE_ENABLE
+    TEST_eeprom_cache();
+#endif
+#if EEPROM_COALESCE == EEPROM_COALESCE_ENABLE
+    TEST_eeprom_coalesce();
+#endif
+#if EEPROM_WAIT_MODE == EEPROM_WAIT_SLEEP
+    TEST_eeprom_sleep_wait();
+#endif
+}
@@ -0,0 +1,226 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 00:35:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 01:26:00                              *
+ * @FilePath              : TEST_gpio.c                                      *
+ ****************************************************************************/
+
+/**
+ * @brief GPIO Driver Tests
+ * @note The registers of the ports are read through IO_ACCESS, and the input levels are driven by SIM_drive_pins.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/GPIO/GPIO_int.h"
+#include "../Atmega32/GPIO/GPIO_fast.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Registers of the tested ports
+ */
+#define TEST_GPIO_B                 IO_ACCESS(GPIO_B_REGS)
+#define TEST_GPIO_D                 IO_ACCESS(GPIO_D_REGS)
+
+/**
+ * @brief Port index of PORT_D in the simulator
+ */
+#define TEST_SIM_PORT_D             3U
+
+/**
+ * @brief Registers of each port (same order as gpio_port_t), used to check the Ports table in flash
+ */
+#define TEST_GPIO_PORTS_REGS        {GPIO_A_REGS, GPIO_B_REGS, GPIO_C_REGS, GPIO_D_REGS}
+
+/**
+ * @brief Value of the registers of PORT_A which is not in the pins configuration table
+ */
+#define TEST_GPIO_UNUSED_VALUE      0x5AU
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Pins configuration table (the second entry overrides the level of PIN_1)
+ */
+static const gpio_config_t TEST_board_pins[] FLASH_CONST =
+{
+    {PORT_B, PIN_0 | PIN_1, PIN_OUTPUT,         PIN_HIGH_LEVEL},
+    {PORT_B, PIN_1,         PIN_OUTPUT,         PIN_LOW_LEVEL },
+    {PORT_C, PIN_ALL,       PIN_PULL_UP_INPUT,  PIN_LOW_LEVEL },
+    {PORT_D, PIN_2,         PIN_FLOATING_INPUT, PIN_LOW_LEVEL }
+};
+
+/**
+ * @brief Pins configuration table with an invalid entry (nothing is written)
+ */
+static const gpio_config_t TEST_invalid_pins[] FLASH_CONST =
+{
+    {PORT_D, PIN_ALL,       PIN_OUTPUT,         PIN_HIGH_LEVEL},
+    {PORT_A, PIN_0,         PIN_MAX_MODE,       PIN_LOW_LEVEL }
+};
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief It tests that the checked APIs reach the registers of each port through the Ports table.
+ */
+static void TEST_gpio_ports(void)
+{
+    GPIO_Reg_S * const ports[PORT_MAX] = TEST_GPIO_PORTS_REGS;
+    gpio_level_t level = PIN_LOW_LEVEL;
+    uint8_t mismatches = 0U;
+    uint8_t port = 0U;
+
+    for (port = 0U; port < PORT_MAX; port++)
+    {
+        (void)GPIO_set_pin_mode((gpio_port_t)port, PIN_ALL, PIN_OUTPUT);
+        (void)GPIO_set_pin_level((gpio_port_t)port, PIN_ALL, PIN_LOW_LEVEL);
+        (void)GPIO_set_pin_level((gpio_port_t)port, (gpio_pin_t)(1U << port), PIN_HIGH_LEVEL);
+        (void)GPIO_tog_pin_level((gpio_port_t)port, PIN_7);
+        mismatches += (((IO_ACCESS(ports[port])->DDR).reg) != 0xFFU) ? 1U : 0U;
+        mismatches += (((IO_ACCESS(ports[port])->PORT).reg) != (uint8_t)((1U << port) | PIN_7)) ? 1U : 0U;
+
+        /* Output pins are read back from PIN */
+        (void)GPIO_get_pin_level((gpio_port_t)port, PIN_7, &level);
+        mismatches += (level != PIN_HIGH_LEVEL) ? 1U : 0U;
+
+        (void)GPIO_set_pin_mode((gpio_port_t)port, PIN_ALL, PIN_FLOATING_INPUT);
+        mismatches += ((((IO_ACCESS(ports[port])->DDR).reg) | ((IO_ACCESS(ports[port])->PORT).reg)) != 0U) ? 1U : 0U;
+    }
+    TEST_CHECK(mismatches == 0U);
+
+    TEST_CHECK(GPIO_set_pin_mode(PORT_MAX, PIN_0, PIN_OUTPUT) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_set_pin_mode(PORT_A, PIN_0, PIN_MAX_MODE) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_set_pin_level(PORT_A, PIN_0, PIN_MAX_LEVEL) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_get_pin_level(PORT_A, PIN_0 | PIN_1, &level) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_tog_pin_level(PORT_MAX, PIN_0) == VALUE_IS_NOT_EXISTED);
+}
+
+/**
+ * @brief It tests the masked whole-port write and the port reads.
+ */
+static void TEST_gpio_port_access(void)
+{
+    uint8_t values[PORT_MAX] = {0U};
+    uint8_t value = 0U;
+
+    /* Only the pins of the mask are written */
+    ((TEST_GPIO_B->DDR).reg) = PIN_ALL;
+    ((TEST_GPIO_B->PORT).reg) = 0x0FU;
+    TEST_CHECK(GPIO_write_port_masked(PORT_B, 0xF0U, 0xA5U) == DRIVER_IS_OK);
+    TEST_CHECK(((TEST_GPIO_B->PORT).reg) == 0xAFU);
+    TEST_CHECK(GPIO_write_port_masked(PORT_B, 0x3CU, 0x00U) == DRIVER_IS_OK);
+    TEST_CHECK(((TEST_GPIO_B->PORT).reg) == 0x83U);
+
+    /* Input pins follow the driven levels, output pins their PORT levels */
+    ((TEST_GPIO_D->DDR).reg) = 0x0FU;
+    ((TEST_GPIO_D->PORT).reg) = 0x05U;
+    (void)SIM_drive_pins(TEST_SIM_PORT_D, 0xF0U, 0x90U);
+    TEST_CHECK((GPIO_read_port(PORT_D, &value) == DRIVER_IS_OK) && (value == 0x95U));
+    TEST_CHECK(GPIO_read_all_ports(values) == DRIVER_IS_OK);
+    TEST_CHECK((values[PORT_B] == 0x83U) && (values[PORT_D] == 0x95U));
+    (void)SIM_release_pins(TEST_SIM_PORT_D, 0xF0U);
+
+    TEST_CHECK(GPIO_write_port_masked(PORT_MAX, PIN_ALL, 0U) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_read_port(PORT_MAX, &value) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_read_port(PORT_A, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(GPIO_read_all_ports(NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+/**
+ * @brief It tests the pins configuration table of GPIO_init.
+ */
+static void TEST_gpio_init(void)
+{
+    GPIO_Reg_S * const ports[PORT_MAX] = TEST_GPIO_PORTS_REGS;
+
+    ((IO_ACCESS(ports[PORT_A])->DDR).reg) = TEST_GPIO_UNUSED_VALUE;
+    ((IO_ACCESS(ports[PORT_A])->PORT).reg) = TEST_GPIO_UNUSED_VALUE;
+    ((IO_ACCESS(ports[PORT_D])->DDR).reg) = PIN_2 | PIN_3;
+    ((IO_ACCESS(ports[PORT_D])->PORT).reg) = PIN_2 | PIN_3;
+
+    TEST_CHECK(GPIO_init(TEST_board_pins, sizeof(TEST_board_pins) / sizeof(TEST_board_pins[0])) == DRIVER_IS_OK);
+    TEST_CHECK((((IO_ACCESS(ports[PORT_B])->DDR).reg) & (PIN_0 | PIN_1)) == (PIN_0 | PIN_1));
+    TEST_CHECK((((IO_ACCESS(ports[PORT_B])->PORT).reg) & (PIN_0 | PIN_1)) == PIN_0);
+    TEST_CHECK((((IO_ACCESS(ports[PORT_C])->DDR).reg) == 0U) && (((IO_ACCESS(ports[PORT_C])->PORT).reg) == PIN_ALL));
+
+    /* Pins which are not in the table keep their mode and level */
+    TEST_CHECK((((IO_ACCESS(ports[PORT_D])->DDR).reg) == PIN_3) && (((IO_ACCESS(ports[PORT_D])->PORT).reg) == PIN_3));
+    TEST_CHECK((((IO_ACCESS(ports[PORT_A])->DDR).reg) == TEST_GPIO_UNUSED_VALUE) &&
+               (((IO_ACCESS(ports[PORT_A])->PORT).reg) == TEST_GPIO_UNUSED_VALUE));
+
+    /* Nothing is written if an entry is not valid */
+    TEST_CHECK(GPIO_init(TEST_invalid_pins, sizeof(TEST_invalid_pins) / sizeof(TEST_invalid_pins[0])) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(((IO_ACCESS(ports[PORT_D])->DDR).reg) == PIN_3);
+    TEST_CHECK(GPIO_init(NULL_PTR, 1U) == PTR_USED_IS_NULL_PTR);
+}
+
+/**
+ * @brief It tests the inline APIs with constant arguments and their checked path with variable arguments.
+ */
+static void TEST_gpio_fast(void)
+{
+    volatile gpio_port_t invalid_port = PORT_MAX;
+    volatile gpio_pin_t pin = PIN_5;
+    gpio_level_t level = PIN_LOW_LEVEL;
+
+    TEST_CHECK(GPIO_set_pin_mode(PORT_B, PIN_3, PIN_OUTPUT) == DRIVER_IS_OK);
+
+    /* Constant arguments use the register directly */
+    TEST_CHECK(GPIO_set_pin_level_fast(PORT_B, PIN_3, PIN_HIGH_LEVEL) == DRIVER_IS_OK);
+    TEST_CHECK((((TEST_GPIO_B->PORT).reg) & PIN_3) == PIN_3);
+    TEST_CHECK(GPIO_tog_pin_level_fast(PORT_B, PIN_3) == DRIVER_IS_OK);
+    TEST_CHECK((((TEST_GPIO_B->PORT).reg) & PIN_3) == 0U);
+    TEST_CHECK(GPIO_tog_pin_level_fast(PORT_B, PIN_3) == DRIVER_IS_OK);
+    TEST_CHECK(GPIO_set_pin_level_fast(PORT_B, PIN_3, PIN_LOW_LEVEL) == DRIVER_IS_OK);
+    TEST_CHECK((((TEST_GPIO_B->PORT).reg) & PIN_3) == 0U);
+
+    /* An input pin follows the level driven on it */
+    TEST_CHECK(GPIO_set_pin_mode(PORT_D, PIN_5, PIN_FLOATING_INPUT) == DRIVER_IS_OK);
+    (void)SIM_drive_pins(TEST_SIM_PORT_D, PIN_5, PIN_5);
+    TEST_CHECK((GPIO_get_pin_level_fast(PORT_D, PIN_5, &level) == DRIVER_IS_OK) && (level == PIN_HIGH_LEVEL));
+    (void)SIM_drive_pins(TEST_SIM_PORT_D, PIN_5, 0U);
+    TEST_CHECK((GPIO_get_pin_level_fast(PORT_D, PIN_5, &level) == DRIVER_IS_OK) && (level == PIN_LOW_LEVEL));
+
+    /* Variable arguments use the checked path */
+    (void)SIM_drive_pins(TEST_SIM_PORT_D, PIN_5, PIN_5);
+    TEST_CHECK((GPIO_get_pin_level_fast(PORT_D, pin, &level) == DRIVER_IS_OK) && (level == PIN_HIGH_LEVEL));
+    TEST_CHECK(GPIO_set_pin_level_fast(invalid_port, PIN_3, PIN_HIGH_LEVEL) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_tog_pin_level_fast(invalid_port, PIN_3) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(GPIO_get_pin_level_fast(PORT_D, PIN_5, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    (void)SIM_release_pins(TEST_SIM_PORT_D, PIN_5);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief GPIO Driver Test Suite
+ */
+void TEST_gpio(void)
+{
+    SIM_reset();
+
+    TEST_gpio_ports();
+    TEST_gpio_port_access();
+    TEST_gpio_init();
+    TEST_gpio_fast();
+}
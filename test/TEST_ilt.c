@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 03:59:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:59:00                              *
+ * @FilePath              : TEST_ilt.c                                       *
+ ****************************************************************************/
+
+/**
+ * @brief Interrupt Latency Tracker Tests
+ * @note The tracker is built with IRQ_LATENCY_TRACKING only, so the suite is empty in the other configurations.
+ * @note The windows are opened by atomic blocks of the test, and their length is set by SIM_advance (Timebase ticks
+ * at TB_PRESCALER_1).
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/ModeManager/MM_int.h"
+#include "../Atmega32/IrqLatency/ILT_int.h"
+#include "../Atmega32/IrqLatency/ILT_priv.h"
+#include "../Atmega32/IrqLatency/ILT_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Length of the measured windows in cycles (the last one is longer than 65535 ticks)
+ */
+#define TEST_ILT_SHORT_CYCLES       20UL
+#define TEST_ILT_LONG_CYCLES        200UL
+#define TEST_ILT_SATURATED_CYCLES   70000UL
+
+/**
+ * @brief Maximum ticks taken by the atomic block itself (ILT_start and ILT_stop read the Timebase)
+ */
+#define TEST_ILT_OVERHEAD_TICKS     40UL
+
+
+#if defined(IRQ_LATENCY_TRACKING)
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to keep Global Interrupt disabled for the given cycles in an atomic block of a site.
+ */
+static void TEST_ilt_window(ilt_site_t site, uint32_t cycles)
+{
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    ATOMIC_ENTER(sreg_state, site);
+    SIM_advance(cycles);
+    ATOMIC_EXIT(sreg_state, site);
+}
+
+/**
+ * @brief This function is used to get the number of windows in the histogram of a site.
+ */
+static uint16_t TEST_ilt_histogram_windows(const ilt_site_stats_t * stats)
+{
+    uint16_t windows = 0U;
+    uint8_t bin = 0U;
+
+    for (bin = 0U; bin < ILT_HISTOGRAM_BINS; bin++)
+    {
+        windows = (uint16_t)(windows + stats->histogram[bin]);
+    }
+
+    return windows;
+}
+
+/**
+ * @brief It tests the last and longest windows of a site, its histogram and the saturated windows.
+ */
+static void TEST_ilt_windows(void)
+{
+    ilt_site_stats_t stats;
+
+    TEST_CHECK(ILT_init() == DRIVER_IS_OK);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+
+    TEST_ilt_window(ILT_BENCH_RUN, TEST_ILT_LONG_CYCLES);
+    TEST_ilt_window(ILT_BENCH_RUN, TEST_ILT_SHORT_CYCLES);
+    TEST_CHECK(ILT_get_stats(ILT_BENCH_RUN, &stats) == DRIVER_IS_OK);
+    TEST_CHECK(stats.windows == 2U);
+    TEST_CHECK((stats.last_ticks >= TEST_ILT_SHORT_CYCLES) &&
+               (stats.last_ticks < (TEST_ILT_SHORT_CYCLES + TEST_ILT_OVERHEAD_TICKS)));
+    TEST_CHECK((stats.max_ticks >= TEST_ILT_LONG_CYCLES) &&
+               (stats.max_ticks < (TEST_ILT_LONG_CYCLES + TEST_ILT_OVERHEAD_TICKS)));
+
+    /* Each window is counted in the bin of its length, long windows are in the last bin */
+    TEST_CHECK(TEST_ilt_histogram_windows(&stats) == stats.windows);
+    TEST_CHECK(stats.histogram[stats.last_ticks >> ILT_BIN_WIDTH_SHIFT] == 1U);
+    TEST_CHECK(stats.histogram[ILT_LAST_BIN] == 1U);
+
+    /* A window longer than the Timebase period is saturated */
+    TEST_ilt_window(ILT_LCAP_CAPTURE, TEST_ILT_SATURATED_CYCLES);
+    TEST_CHECK(ILT_get_stats(ILT_LCAP_CAPTURE, &stats) == DRIVER_IS_OK);
+    TEST_CHECK((stats.windows == 1U) && (stats.last_ticks == ILT_MAX_TICKS));
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+}
+
+/**
+ * @brief It tests that only the outermost window is measured and that the driver blocks have their own sites.
+ */
+static void TEST_ilt_sites(void)
+{
+    ilt_site_stats_t stats;
+    uint8_t sreg_state = CLEAR_VALUE;
+
+    TEST_CHECK(ILT_init() == DRIVER_IS_OK);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+
+    /* The nested block is counted in the window of the outer one */
+    ATOMIC_ENTER(sreg_state, ILT_BENCH_RUN);
+    TEST_ilt_window(ILT_LCAP_CAPTURE, TEST_ILT_LONG_CYCLES);
+    ATOMIC_EXIT(sreg_state, ILT_BENCH_RUN);
+    TEST_CHECK((ILT_get_stats(ILT_LCAP_CAPTURE, &stats) == DRIVER_IS_OK) && (stats.windows == 0U));
+    TEST_CHECK((ILT_get_stats(ILT_BENCH_RUN, &stats) == DRIVER_IS_OK) && (stats.windows == 1U));
+    TEST_CHECK(stats.last_ticks >= TEST_ILT_LONG_CYCLES);
+
+    /* A driver block is recorded for its site */
+    TEST_CHECK(MM_acquire(MM_ADC_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(MM_release(MM_ADC_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK((ILT_get_stats(ILT_MM_ACQUIRE, &stats) == DRIVER_IS_OK) && (stats.windows == 1U));
+    TEST_CHECK((ILT_get_stats(ILT_MM_RELEASE, &stats) == DRIVER_IS_OK) && (stats.windows == 1U));
+
+    /* A block which is entered with Global Interrupt disabled is not measured */
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    TEST_ilt_window(ILT_LCAP_CAPTURE, TEST_ILT_LONG_CYCLES);
+    TEST_CHECK((ILT_get_stats(ILT_LCAP_CAPTURE, &stats) == DRIVER_IS_OK) && (stats.windows == 0U));
+
+    TEST_CHECK(ILT_get_stats(ILT_MAX_SITE, &stats) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(ILT_get_stats(ILT_BENCH_RUN, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+#endif
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Interrupt Latency Tracker Test Suite
+ */
+void TEST_ilt(void)
+{
+    SIM_reset();
+
+#if defined(IRQ_LATENCY_TRACKING)
+    TEST_ilt_windows();
+    TEST_ilt_sites();
+#endif
+}
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 04:16:00                              *
+ * @FilePath              : TEST_int.h                                       *
+ ****************************************************************************/
+
+#ifndef TEST_TEST_INT_H_
+#define TEST_TEST_INT_H_
+
+/**
+ * @section Includes
+ */
+
+#include "../MC_driver.h"
+
+/**
+ * @section Macros
+ */
+
+/**
+ * @brief It checks a condition and records the failure (file, line and condition) without stopping the suite.
+ */
+#define TEST_CHECK(condition)       TEST_check((uint8_t)((condition) ? SET_VALUE : CLEAR_VALUE), __FILE__, __LINE__, #condition)
+
+/**
+ * @brief Number of simulated cycles the tests let pass between two calls of a non blocking API.
+ */
+#define TEST_STEP_CYCLES            500UL
+
+/**
+ * @brief Maximum number of calls of a non blocking API before the test gives up.
+ */
+#define TEST_MAX_CALLS              100000UL
+
+/**
+ * @section Function Prototypes
+ */
+
+void TEST_check (uint8_t passed, const char * file, int line, const char * condition);
+
+/**
+ * @brief Test Suites (each one resets the host simulator first)
+ */
+void TEST_eeprom(void);
+void TEST_rec   (void);
+void TEST_cb    (void);
+void TEST_kv    (void);
+void TEST_gpio  (void);
+void TEST_deb   (void);
+void TEST_lcap  (void);
+void TEST_sch   (void);
+void TEST_mm    (void);
+void TEST_ilt   (void);
+void TEST_stk   (void);
+
+#endif
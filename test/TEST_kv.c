@@ -0,0 +1,273 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:42:00                              *
+ * @FilePath              : TEST_kv.c                                        *
+ ****************************************************************************/
+
+/**
+ * @brief Key-Value Store Tests
+ * @note The store is checked against a shadow copy of the keys kept in RAM.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/EEPROM/EEPROM_int.h"
+#include "../Atmega32/Timebase/TB_int.h"
+#include "../Atmega32/KeyValue/KV_int.h"
+#include "../Atmega32/KeyValue/KV_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+#define TEST_KV_KEYS                40U
+#define TEST_KV_MAX_LENGTH          4U
+#define TEST_KV_SETS                3000U
+
+/**
+ * @brief A compaction is requested every TEST_KV_COMPACT_PERIOD sets
+ */
+#define TEST_KV_COMPACT_PERIOD      7U
+
+/**
+ * @brief First key which is not in the shadow (used to fill the store)
+ */
+#define TEST_KV_FILL_KEY            60U
+
+/**
+ * @brief Linear congruential generator of the test values
+ */
+#define TEST_KV_RANDOM(seed)        (((seed) * 1103515245UL) + 12345UL)
+
+/**
+ * @brief Short EEPROM program time to keep the long tests fast
+ */
+#define TEST_KV_PROGRAM_CYCLES      10U
+
+
+/**
+ * @section Global Variables
+ */
+
+static uint8_t TEST_kv_values[TEST_KV_KEYS][TEST_KV_MAX_LENGTH];
+static uint8_t TEST_kv_lengths[TEST_KV_KEYS];
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to set a key until its value is completely written.
+ */
+static driver_status_t TEST_kv_set(uint8_t key, uint8_t * value, uint8_t length)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t calls = 0U;
+
+    do
+    {
+        status = KV_set(key, value, length);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+
+    return status;
+}
+
+/**
+ * @brief This function is used to compare all keys with the shadow.
+ * @return The number of keys which differ from the shadow.
+ */
+static uint16_t TEST_kv_mismatches(void)
+{
+    uint8_t value[KV_MAX_VALUE_SIZE] = {0U};
+    driver_status_t status = DRIVER_IS_OK;
+    uint16_t mismatches = 0U;
+    uint8_t length = 0U;
+    uint8_t key = 0U;
+    uint8_t index = 0U;
+
+    for (key = 0U; key < TEST_KV_KEYS; key++)
+    {
+        length = KV_MAX_VALUE_SIZE;
+        status = KV_get(key, value, &length);
+
+        if (TEST_kv_lengths[key] == 0U)
+        {
+            mismatches += (status != KV_KEY_IS_NOT_FOUND) ? 1U : 0U;
+        }
+        else if ((status != EEPROM_DATA_IS_READ) || (length != TEST_kv_lengths[key]))
+        {
+            mismatches++;
+        }
+        else
+        {
+            for (index = 0U; index < length; index++)
+            {
+                mismatches += (value[index] != TEST_kv_values[key][index]) ? 1U : 0U;
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+/**
+ * @brief It tests random sets with periodic compactions, then the rebuild of the index (as after a reset).
+ */
+static void TEST_kv_random_sets(void)
+{
+    kv_stats_t stats;
+    driver_status_t status = DRIVER_IS_OK;
+    uint8_t value[TEST_KV_MAX_LENGTH] = {0U};
+    uint32_t seed = 1U;
+    uint32_t writes = 0U;
+    uint16_t failed_sets = 0U;
+    uint16_t set = 0U;
+    uint32_t calls = 0U;
+    uint8_t length = 0U;
+    uint8_t key = 0U;
+    uint8_t index = 0U;
+
+    TEST_CHECK(KV_init() == DRIVER_IS_OK);
+
+    for (set = 0U; set < TEST_KV_SETS; set++)
+    {
+        seed = TEST_KV_RANDOM(seed);
+        key = (uint8_t)((seed >> 16U) % TEST_KV_KEYS);
+        length = (uint8_t)(1U + ((seed >> 8U) % TEST_KV_MAX_LENGTH));
+        for (index = 0U; index < length; index++)
+        {
+            value[index] = (uint8_t)(seed >> (index * 3U));
+        }
+
+        if (TEST_kv_set(key, value, length) == EEPROM_DATA_IS_WRITTEN)
+        {
+            TEST_kv_lengths[key] = length;
+            for (index = 0U; index < length; index++)
+            {
+                TEST_kv_values[key][index] = value[index];
+            }
+        }
+        else
+        {
+            failed_sets++;
+        }
+
+        if ((set % TEST_KV_COMPACT_PERIOD) == 0U)
+        {
+            calls = 0U;
+            do
+            {
+                status = KV_compact();
+                SIM_advance(TEST_STEP_CYCLES);
+                calls++;
+            } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    TEST_CHECK(failed_sets == 0U);
+    TEST_CHECK(TEST_kv_mismatches() == 0U);
+    TEST_CHECK((KV_get_stats(&stats) == DRIVER_IS_OK) && (stats.compactions != 0U));
+
+    /* Same value programs nothing */
+    key = 3U;
+    writes = SIM_get_eeprom_writes();
+    TEST_CHECK(TEST_kv_set(key, TEST_kv_values[key], TEST_kv_lengths[key]) == EEPROM_DATA_IS_WRITTEN);
+    TEST_CHECK(SIM_get_eeprom_writes() == writes);
+
+    /* Rebuild */
+    TEST_CHECK(KV_init() == DRIVER_IS_OK);
+    TEST_CHECK(TEST_kv_mismatches() == 0U);
+    TEST_CHECK((KV_get_stats(&stats) == DRIVER_IS_OK) && (stats.boot_entries != 0U));
+    TEST_CHECK(stats.boot_ticks != 0U);
+}
+
+/**
+ * @brief It tests that a set interrupted before its key is written keeps the previous value.
+ */
+static void TEST_kv_torn_set(void)
+{
+    uint8_t value[2] = {0xABU, 0xCDU};
+    uint16_t address = 0U;
+    uint16_t entry = 0U;
+    uint8_t key = 7U;
+
+    TEST_CHECK(TEST_kv_set(key, value, 2U) == EEPROM_DATA_IS_WRITTEN);
+
+    /* Find the new entry (key, length, value) at the end of the log */
+    for (address = KV_BASE_ADDRESS; address < (KV_BASE_ADDRESS + (2U * KV_HALF_SIZE) - 4U); address++)
+    {
+        if ((SIM_eeprom_peek(address) == key) && (SIM_eeprom_peek(address + 1U) == 2U) &&
+            (SIM_eeprom_peek(address + 2U) == 0xABU) && (SIM_eeprom_peek(address + 3U) == 0xCDU) &&
+            (SIM_eeprom_peek(address + 4U) == KV_NO_KEY))
+        {
+            entry = address;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    TEST_CHECK(entry != 0U);
+
+    /* Erase its key as if the set was interrupted before the key was written */
+    SIM_eeprom_poke(entry, KV_NO_KEY);
+    TEST_CHECK(KV_init() == DRIVER_IS_OK);
+    TEST_CHECK(TEST_kv_mismatches() == 0U);
+}
+
+/**
+ * @brief It tests the full index and the invalid arguments.
+ */
+static void TEST_kv_limits(void)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint8_t value[KV_MAX_VALUE_SIZE + 1U] = {0U};
+    uint8_t length = 1U;
+    uint8_t key = 0U;
+
+    for (key = TEST_KV_FILL_KEY; (key < KV_NO_KEY) && (status != KV_KEYS_ARE_FULL) && (status != KV_LOG_IS_FULL); key++)
+    {
+        status = TEST_kv_set(key, value, 1U);
+    }
+    TEST_CHECK((status == KV_KEYS_ARE_FULL) || (status == KV_LOG_IS_FULL));
+    TEST_CHECK(TEST_kv_mismatches() == 0U);
+
+    TEST_CHECK(KV_set(KV_NO_KEY, value, 1U) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(KV_set(0U, value, KV_MAX_VALUE_SIZE + 1U) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(KV_get(0U, NULL_PTR, &length) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(KV_get(KV_NO_KEY, value, &length) == KV_KEY_IS_NOT_FOUND);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Key-Value Store Test Suite
+ */
+void TEST_kv(void)
+{
+    SIM_reset();
+    SIM_set_eeprom_program_time(TEST_KV_PROGRAM_CYCLES);
+    (void)EEPROM_init();
+    (void)TB_init();
+
+    TEST_kv_random_sets();
+    TEST_kv_torn_set();
+    TEST_kv_limits();
+}
@@ -0,0 +1,163 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 02:17:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:17:00                              *
+ * @FilePath              : TEST_lcap.c                                      *
+ ****************************************************************************/
+
+/**
+ * @brief Logic Capture Tests
+ * @note The pins of PORT_B are floating inputs whose levels are driven by SIM_drive_pins before the capture.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/GPIO/GPIO_int.h"
+#include "../Atmega32/Timebase/TB_int.h"
+#include "../Atmega32/LogicCapture/LCAP_int.h"
+#include "../Atmega32/LogicCapture/LCAP_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Port index of PORT_B in the simulator
+ */
+#define TEST_SIM_PORT_B             1U
+
+/**
+ * @brief Levels driven on PORT_B and the captured pins
+ */
+#define TEST_LCAP_LEVELS            0x35U
+#define TEST_LCAP_MASK              0x0FU
+
+/**
+ * @brief Longest run of one entry
+ */
+#define TEST_LCAP_MAX_RUN           255U
+
+/**
+ * @brief Samples of the short capture, they use three entries (255, 255 and 90 samples)
+ */
+#define TEST_LCAP_SAMPLES           600UL
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Number of bytes sent by LCAP_dump
+ */
+static uint32_t TEST_lcap_dumped = 0U;
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used as output of LCAP_dump, it counts the sent bytes.
+ */
+static void TEST_lcap_output(uint8_t byte)
+{
+    (void)byte;
+    TEST_lcap_dumped++;
+}
+
+/**
+ * @brief It tests the Run-Length entries of a capture and their dump.
+ */
+static void TEST_lcap_entries(void)
+{
+    uint16_t entries = 0U;
+    uint8_t value = 0U;
+    uint8_t run = 0U;
+
+    TEST_CHECK(LCAP_capture(PORT_B, TEST_LCAP_MASK, TEST_LCAP_SAMPLES, &entries) == DRIVER_IS_OK);
+    TEST_CHECK(entries == 3U);
+
+    /* The level is masked and the runs are split at their maximum */
+    TEST_CHECK(LCAP_get_entry(0U, &value, &run) == DRIVER_IS_OK);
+    TEST_CHECK((value == (TEST_LCAP_LEVELS & TEST_LCAP_MASK)) && (run == TEST_LCAP_MAX_RUN));
+    TEST_CHECK(LCAP_get_entry(1U, &value, &run) == DRIVER_IS_OK);
+    TEST_CHECK((value == (TEST_LCAP_LEVELS & TEST_LCAP_MASK)) && (run == TEST_LCAP_MAX_RUN));
+    TEST_CHECK(LCAP_get_entry(2U, &value, &run) == DRIVER_IS_OK);
+    TEST_CHECK((value == (TEST_LCAP_LEVELS & TEST_LCAP_MASK)) &&
+               (run == (TEST_LCAP_SAMPLES - (2U * TEST_LCAP_MAX_RUN))));
+    TEST_CHECK(LCAP_get_entry(3U, &value, &run) == VALUE_IS_NOT_EXISTED);
+
+    /* Each entry is dumped as (value, run) bytes */
+    TEST_lcap_dumped = 0U;
+    TEST_CHECK(LCAP_dump(TEST_lcap_output) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_lcap_dumped == (2U * entries));
+}
+
+/**
+ * @brief It tests a capture which fills the buffer, it lasts many Timebase periods with Global Interrupt disabled,
+ * so the extended ticks must count all of them.
+ */
+static void TEST_lcap_long_capture(void)
+{
+    uint16_t entries = 0U;
+    uint32_t samples = ((uint32_t)LCAP_BUFFER_ENTRIES * TEST_LCAP_MAX_RUN);
+    uint32_t start = 0U;
+    uint32_t elapsed = 0U;
+
+    start = TB_get_ticks32();
+    TEST_CHECK(LCAP_capture(PORT_B, TEST_LCAP_MASK, samples + 1U, &entries) == LCAP_BUFFER_IS_FULL);
+    elapsed = TB_get_ticks32() - start;
+    TEST_CHECK(entries == LCAP_BUFFER_ENTRIES);
+
+    /* The capture takes one sample period per sample */
+    TEST_CHECK(elapsed >= (samples * LCAP_SAMPLE_PERIOD));
+    TEST_CHECK(elapsed < ((samples + 2U) * LCAP_SAMPLE_PERIOD));
+}
+
+/**
+ * @brief It tests the invalid arguments.
+ */
+static void TEST_lcap_arguments(void)
+{
+    uint16_t entries = 0U;
+    uint8_t value = 0U;
+
+    TEST_CHECK(LCAP_capture(PORT_B, TEST_LCAP_MASK, TEST_LCAP_SAMPLES, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(LCAP_capture(PORT_MAX, TEST_LCAP_MASK, TEST_LCAP_SAMPLES, &entries) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(LCAP_capture(PORT_B, TEST_LCAP_MASK, 0U, &entries) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(LCAP_get_entry(0U, &value, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(LCAP_dump(NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Logic Capture Test Suite
+ */
+void TEST_lcap(void)
+{
+    SIM_reset();
+
+    (void)TB_init();
+    (void)GPIO_set_pin_mode(PORT_B, PIN_ALL, PIN_FLOATING_INPUT);
+    (void)SIM_drive_pins(TEST_SIM_PORT_B, PIN_ALL, TEST_LCAP_LEVELS);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+
+    TEST_lcap_entries();
+    TEST_lcap_long_capture();
+    TEST_lcap_arguments();
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    (void)SIM_release_pins(TEST_SIM_PORT_B, PIN_ALL);
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 04:16:00                              *
+ * @FilePath              : TEST_main.c                                      *
+ ****************************************************************************/
+
+/**
+ * @brief Host Test Runner
+ * @note It runs the driver tests on the host simulator (make test builds it once per tested configuration of
+ * EEPROM_cfg.h), prints each failed check then "TEST PASS" or "TEST FAIL", and the exit code is not zero if a
+ * check fails.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include <stdio.h>
+#include "TEST_int.h"
+
+
+/**
+ * @section Global Variables
+ */
+
+static uint32_t TEST_checks = 0U;
+static uint32_t TEST_failures = 0U;
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief This function is used to record the result of a check.
+ * @param passed SET_VALUE if the check passed.
+ * @param file The file of the check.
+ * @param line The line of the check.
+ * @param condition The checked condition.
+ */
+void TEST_check(uint8_t passed, const char * file, int line, const char * condition)
+{
+    TEST_checks++;
+
+    if (passed == CLEAR_VALUE)
+    {
+        TEST_failures++;
+        printf("TEST %s:%d FAILED: %s\n", file, line, condition);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+int main(void)
+{
+    TEST_eeprom();
+    TEST_rec();
+    TEST_cb();
+    TEST_kv();
+    TEST_gpio();
+    TEST_deb();
+    TEST_lcap();
+    TEST_sch();
+    TEST_mm();
+    TEST_ilt();
+    TEST_stk();
+
+    /* Print the verdict */
+    printf("TEST %s (%lu checks, %lu failed)\n", (TEST_failures == 0U) ? "PASS" : "FAIL",
+           (unsigned long)TEST_checks, (unsigned long)TEST_failures);
+
+    return (TEST_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 02:51:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 03:08:00                              *
+ * @FilePath              : TEST_mm.c                                        *
+ ****************************************************************************/
+
+/**
+ * @brief Mode Manager Tests
+ * @note The sleep instruction is replaced by a sleep hook which records the selected Sleep Mode.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/Timebase/TB_int.h"
+#include "../Atmega32/ModeManager/MM_int.h"
+#include "../Atmega32/ModeManager/MM_priv.h"
+#include "../Atmega32/ModeManager/MM_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Deadlines which only fit the wake-up latency of the Standby and Idle Modes
+ */
+#define TEST_MM_STANDBY_DEADLINE    (MM_STANDBY_WAKEUP_CYCLES + 1UL)
+#define TEST_MM_IDLE_DEADLINE       (MM_IDLE_WAKEUP_CYCLES + 1UL)
+
+/**
+ * @brief Cycles spent by the statistics sleep hook before and after the wake-up (Timebase ticks at TB_PRESCALER_1)
+ */
+#define TEST_MM_SLEEP_CYCLES        1000UL
+#define TEST_MM_WAKEUP_CYCLES       100UL
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Number of sleeps and Sleep Mode of the last one
+ */
+static uint8_t TEST_mm_sleeps = 0U;
+static uint8_t TEST_mm_sleep_mode = 0U;
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function replaces the sleep instruction, it records the Sleep Mode.
+ */
+static void TEST_mm_sleep_hook(uint8_t mode)
+{
+    TEST_mm_sleeps++;
+    TEST_mm_sleep_mode = mode;
+}
+
+#if MM_STATS == MM_STATS_ENABLE
+/**
+ * @brief This function replaces the sleep instruction, it sleeps then the waking interrupt stamps the wake-up time.
+ */
+static void TEST_mm_stats_hook(uint8_t mode)
+{
+    TEST_mm_sleep_hook(mode);
+    SIM_advance(TEST_MM_SLEEP_CYCLES);
+    MM_mark_wakeup();
+    SIM_advance(TEST_MM_WAKEUP_CYCLES);
+}
+#endif
+
+/**
+ * @brief This function is used to call MM_idle as the super loop does (with Global Interrupt disabled).
+ * @return The selected mode (LAST_MODE if MM_idle failed, did not sleep in the selected mode or did not enable
+ * Global Interrupt).
+ */
+static mode_t TEST_mm_idle(uint32_t cycles_to_deadline)
+{
+    mode_t mode = LAST_MODE;
+    uint8_t sleeps = TEST_mm_sleeps;
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    if (MM_idle(cycles_to_deadline, &mode) != DRIVER_IS_OK)
+    {
+        mode = LAST_MODE;
+    }
+    else if (((SREG->bits).I) != GLOBAL_INTERRUPT_ENABLE)
+    {
+        mode = LAST_MODE;
+    }
+    else if (mode == NORMAL_MODE)
+    {
+        mode = (TEST_mm_sleeps == sleeps) ? NORMAL_MODE : LAST_MODE;
+    }
+    else
+    {
+        mode = ((TEST_mm_sleeps == (sleeps + 1U)) && (TEST_mm_sleep_mode == (uint8_t)mode)) ? mode : LAST_MODE;
+    }
+
+    return mode;
+}
+
+/**
+ * @brief It tests the Sleep Mode selected by MM_idle for the needed resources and the deadline.
+ */
+static void TEST_mm_idle_modes(void)
+{
+    /* No resource is needed */
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == PWR_DOWN_MODE);
+    TEST_CHECK(TEST_mm_idle(TEST_MM_STANDBY_DEADLINE) == STANDBY_MODE);
+    TEST_CHECK(TEST_mm_idle(TEST_MM_IDLE_DEADLINE) == ADC_NOISE_REDUCTION_MODE);
+    TEST_CHECK(TEST_mm_idle(MM_IDLE_WAKEUP_CYCLES) == NORMAL_MODE);
+
+    /* Each resource keeps the modes which do not stop it */
+    TEST_CHECK(MM_acquire(MM_ASYNC_TIMER_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == PWR_SAVE_MODE);
+    TEST_CHECK(TEST_mm_idle(TEST_MM_STANDBY_DEADLINE) == EXTENDED_STANDBY_MODE);
+    TEST_CHECK(MM_release(MM_ASYNC_TIMER_RESOURCE) == DRIVER_IS_OK);
+
+    TEST_CHECK(MM_acquire(MM_EEPROM_READY_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == ADC_NOISE_REDUCTION_MODE);
+
+    /* A resource is needed while it has users */
+    TEST_CHECK(MM_acquire(MM_IO_CLK_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(MM_acquire(MM_IO_CLK_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == IDLE_MODE);
+    TEST_CHECK(MM_release(MM_IO_CLK_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == IDLE_MODE);
+    TEST_CHECK(MM_release(MM_IO_CLK_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(MM_release(MM_EEPROM_READY_RESOURCE) == DRIVER_IS_OK);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == PWR_DOWN_MODE);
+}
+
+/**
+ * @brief It tests the Sleep Statistics (measured only if they are enabled in MM_cfg.h).
+ */
+static void TEST_mm_stats(void)
+{
+    mm_stats_t stats;
+
+#if MM_STATS == MM_STATS_ENABLE
+    mm_stats_t previous;
+
+    (void)TB_init();
+    TEST_CHECK(MM_get_stats(PWR_DOWN_MODE, &previous) == DRIVER_IS_OK);
+    SIM_set_sleep_hook(TEST_mm_stats_hook);
+    TEST_CHECK(TEST_mm_idle(MM_NO_DEADLINE) == PWR_DOWN_MODE);
+    SIM_set_sleep_hook(TEST_mm_sleep_hook);
+
+    /* The sleep is split at the wake-up stamp into residency and wake-up latency */
+    TEST_CHECK(MM_get_stats(PWR_DOWN_MODE, &stats) == DRIVER_IS_OK);
+    TEST_CHECK(stats.entries == (previous.entries + 1U));
+    TEST_CHECK(stats.last_wakeup_ticks >= TEST_MM_WAKEUP_CYCLES);
+    TEST_CHECK(stats.max_wakeup_ticks >= stats.last_wakeup_ticks);
+    TEST_CHECK(((stats.residency_ticks - previous.residency_ticks) + stats.last_wakeup_ticks) >=
+               (TEST_MM_SLEEP_CYCLES + TEST_MM_WAKEUP_CYCLES));
+    TEST_CHECK(MM_get_stats(NORMAL_MODE, &stats) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(MM_get_stats(IDLE_MODE, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+#else
+    /* The API is defined in all configurations */
+    TEST_CHECK(MM_get_stats(PWR_DOWN_MODE, &stats) == VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS);
+#endif
+}
+
+/**
+ * @brief It tests the mode APIs and the invalid arguments.
+ */
+static void TEST_mm_arguments(void)
+{
+    mode_t mode = LAST_MODE;
+
+    TEST_CHECK(MM_set_mode(NORMAL_MODE) == DRIVER_IS_OK);
+    TEST_CHECK((MM_get_mode(&mode) == DRIVER_IS_OK) && (mode == NORMAL_MODE));
+    TEST_CHECK(MM_set_mode(LAST_MODE) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(MM_set_mode_atomic(NORMAL_MODE) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(MM_get_mode(NULL_PTR) == PTR_USED_IS_NULL_PTR);
+
+    TEST_CHECK(MM_acquire(MM_MAX_RESOURCE) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(MM_release(MM_MAX_RESOURCE) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(MM_release(MM_ADC_RESOURCE) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+
+    /* MM_idle must be called with Global Interrupt disabled */
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_ENABLE;
+    TEST_CHECK(MM_idle(MM_NO_DEADLINE, &mode) == VALUE_IS_NOT_COMPATIBLE_WITH_OTHER_CONFIGURATIONS);
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    TEST_CHECK(MM_idle(MM_NO_DEADLINE, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Mode Manager Test Suite
+ */
+void TEST_mm(void)
+{
+    SIM_reset();
+    SIM_set_sleep_hook(TEST_mm_sleep_hook);
+
+    TEST_mm_idle_modes();
+    TEST_mm_stats();
+    TEST_mm_arguments();
+
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+    SIM_set_sleep_hook(NULL_PTR);
+}
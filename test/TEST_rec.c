@@ -0,0 +1,221 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-17 22:05:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 00:01:00                              *
+ * @FilePath              : TEST_rec.c                                       *
+ ****************************************************************************/
+
+/**
+ * @brief Record Store Tests
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/EEPROM/EEPROM_int.h"
+#include "../Atmega32/RecordStore/REC_int.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+#define TEST_REC_BASE_ADDRESS       100U
+#define TEST_REC_SLOTS              10U
+#define TEST_REC_RECORD_SIZE        4U
+#define TEST_REC_SLOT_SIZE          (TEST_REC_RECORD_SIZE + 2U)
+#define TEST_REC_REGION_LENGTH      (TEST_REC_SLOTS * TEST_REC_SLOT_SIZE)
+
+/**
+ * @brief Number of written records (the 16-bit sequence number wraps around)
+ */
+#define TEST_REC_WRITES             70000UL
+
+/**
+ * @brief Expected value of an empty store
+ */
+#define TEST_REC_NO_VALUE           0xFFFFFFFFUL
+
+/**
+ * @brief Short EEPROM program time to keep the long tests fast
+ */
+#define TEST_REC_PROGRAM_CYCLES     10U
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to format an empty store.
+ */
+static void TEST_rec_format(rec_store_t * store)
+{
+    uint32_t calls = 0U;
+
+    SIM_reset();
+    SIM_set_eeprom_program_time(TEST_REC_PROGRAM_CYCLES);
+    (void)EEPROM_init();
+    (void)REC_init(store, TEST_REC_BASE_ADDRESS, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE);
+    while ((REC_format(store) != EEPROM_DATA_IS_WRITTEN) && (calls < TEST_MAX_CALLS))
+    {
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    }
+    (void)REC_init(store, TEST_REC_BASE_ADDRESS, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE);
+}
+
+/**
+ * @brief This function is used to write a record holding a value.
+ */
+static driver_status_t TEST_rec_write(rec_store_t * store, uint32_t value)
+{
+    driver_status_t status = DRIVER_IS_OK;
+    uint8_t record[TEST_REC_RECORD_SIZE] = {(uint8_t)value, (uint8_t)(value >> 8U), (uint8_t)(value >> 16U), (uint8_t)(value >> 24U)};
+    uint32_t calls = 0U;
+
+    do
+    {
+        status = REC_write(store, record);
+        SIM_advance(TEST_STEP_CYCLES);
+        calls++;
+    } while ((status == EEPROM_DATA_IS_NOT_COMPLETELY_WRITTEN) && (calls < TEST_MAX_CALLS));
+
+    return status;
+}
+
+/**
+ * @brief This function is used to check the newest record found by a new handle (as after a reset).
+ * @return SET_VALUE if it holds the expected value (or the store is empty if TEST_REC_NO_VALUE is expected).
+ */
+static uint8_t TEST_rec_is_newest(uint32_t expected)
+{
+    rec_store_t store;
+    uint8_t record[TEST_REC_RECORD_SIZE] = {0U};
+    driver_status_t status = DRIVER_IS_OK;
+    uint32_t value = 0U;
+    uint8_t result = CLEAR_VALUE;
+
+    (void)REC_init(&store, TEST_REC_BASE_ADDRESS, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE);
+    status = REC_read(&store, record);
+    value = (uint32_t)record[0] | ((uint32_t)record[1] << 8U) | ((uint32_t)record[2] << 16U) | ((uint32_t)record[3] << 24U);
+
+    if (expected == TEST_REC_NO_VALUE)
+    {
+        result = (status == REC_NO_RECORD_IS_STORED) ? SET_VALUE : CLEAR_VALUE;
+    }
+    else
+    {
+        result = ((status == EEPROM_DATA_IS_READ) && (value == expected)) ? SET_VALUE : CLEAR_VALUE;
+    }
+
+    return result;
+}
+
+/**
+ * @brief It tests the rotation of the records over the slots, the wrap around of the sequence numbers and the number
+ * of programmed bytes.
+ */
+static void TEST_rec_rotation(void)
+{
+    rec_store_t store;
+    uint32_t value = 0U;
+    uint32_t failed_writes = 0U;
+    uint32_t failed_reads = 0U;
+    uint32_t writes = 0U;
+
+    TEST_rec_format(&store);
+    TEST_CHECK(TEST_rec_is_newest(TEST_REC_NO_VALUE) == SET_VALUE);
+    writes = SIM_get_eeprom_writes();
+
+    for (value = 1U; value <= TEST_REC_WRITES; value++)
+    {
+        failed_writes += (TEST_rec_write(&store, value) != EEPROM_DATA_IS_WRITTEN) ? 1U : 0U;
+
+        /* Check the first rotations, around the wrap around and some others */
+        if ((value < 25U) || ((value > 65520U) && (value < 65560U)) || ((value % 997U) == 0U))
+        {
+            failed_reads += (TEST_rec_is_newest(value) == CLEAR_VALUE) ? 1U : 0U;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    TEST_CHECK(failed_writes == 0U);
+    TEST_CHECK(failed_reads == 0U);
+    TEST_CHECK(TEST_rec_is_newest(TEST_REC_WRITES) == SET_VALUE);
+
+    /* The programmed bytes of both phases (record and sequence number) are counted */
+    TEST_CHECK(store.programmed_bytes == (SIM_get_eeprom_writes() - writes));
+}
+
+/**
+ * @brief It tests that an interrupted write (torn sequence number) never hides the previous record.
+ */
+static void TEST_rec_torn_write(void)
+{
+    rec_store_t store;
+    uint32_t value = 0U;
+    uint16_t address = 0U;
+
+    /* Torn newest slot in the middle of the region */
+    TEST_rec_format(&store);
+    for (value = 1U; value <= 25U; value++)
+    {
+        (void)TEST_rec_write(&store, value);
+    }
+    address = (uint16_t)(TEST_REC_BASE_ADDRESS + (store.newest_slot * TEST_REC_SLOT_SIZE) + TEST_REC_RECORD_SIZE);
+    SIM_eeprom_poke(address, (uint8_t)(SIM_eeprom_peek(address) ^ 0x5AU));
+    TEST_CHECK(TEST_rec_is_newest(24U) == SET_VALUE);
+
+    /* Torn first slot after a complete rotation */
+    TEST_rec_format(&store);
+    for (value = 1U; value <= 21U; value++)
+    {
+        (void)TEST_rec_write(&store, value);
+    }
+    TEST_CHECK(store.newest_slot == 0U);
+    SIM_eeprom_poke(TEST_REC_BASE_ADDRESS + TEST_REC_RECORD_SIZE, (uint8_t)(SIM_eeprom_peek(TEST_REC_BASE_ADDRESS + TEST_REC_RECORD_SIZE) ^ 0x33U));
+    TEST_CHECK(TEST_rec_is_newest(20U) == SET_VALUE);
+
+    /* Torn first record of the store */
+    TEST_rec_format(&store);
+    (void)TEST_rec_write(&store, 1U);
+    SIM_eeprom_poke(TEST_REC_BASE_ADDRESS + TEST_REC_RECORD_SIZE + 1U, 0xFFU);
+    TEST_CHECK(TEST_rec_is_newest(TEST_REC_NO_VALUE) == SET_VALUE);
+}
+
+/**
+ * @brief It tests the invalid arguments.
+ */
+static void TEST_rec_arguments(void)
+{
+    rec_store_t store;
+
+    TEST_CHECK(REC_init(&store, 1000U, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE) == EEPROM_ADDRESS_NOT_AVAILABLE);
+    TEST_CHECK(REC_init(&store, TEST_REC_BASE_ADDRESS, TEST_REC_SLOT_SIZE, TEST_REC_RECORD_SIZE) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(REC_init(NULL_PTR, TEST_REC_BASE_ADDRESS, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(REC_init(&store, TEST_REC_BASE_ADDRESS, TEST_REC_REGION_LENGTH, TEST_REC_RECORD_SIZE) == DRIVER_IS_OK);
+    TEST_CHECK(REC_read(&store, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Record Store Test Suite
+ */
+void TEST_rec(void)
+{
+    TEST_rec_rotation();
+    TEST_rec_torn_write();
+    TEST_rec_arguments();
+}
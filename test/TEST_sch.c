@@ -0,0 +1,185 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 02:34:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 02:34:00                              *
+ * @FilePath              : TEST_sch.c                                       *
+ ****************************************************************************/
+
+/**
+ * @brief Scheduler Tests
+ * @note The simulated time is advanced by one tick period between two dispatches, as the super loop would do.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/Scheduler/SCH_int.h"
+#include "../Atmega32/Scheduler/SCH_priv.h"
+#include "../Atmega32/Scheduler/SCH_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Cycles of one scheduler tick (Timer/Counter0 at SCH_PRESCALER_64 in CTC Mode)
+ */
+#define TEST_SCH_TICK_CYCLES        (64UL * (SCH_TICK_COMPARE + 1UL))
+
+/**
+ * @brief Number of ticks of the periods test
+ */
+#define TEST_SCH_TICKS              12U
+
+/**
+ * @brief Cycles taken by the slow task and its budget (Timebase ticks at TB_PRESCALER_1)
+ */
+#define TEST_SCH_SLOW_CYCLES        1000UL
+#define TEST_SCH_SLOW_BUDGET        500U
+
+
+/**
+ * @section Global Variables
+ */
+
+/**
+ * @brief Number of runs of each test task
+ */
+static uint16_t TEST_sch_fast_runs = 0U;
+static uint16_t TEST_sch_slow_runs = 0U;
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief A short task.
+ */
+static void TEST_sch_fast_task(void)
+{
+    TEST_sch_fast_runs++;
+}
+
+/**
+ * @brief A task which takes TEST_SCH_SLOW_CYCLES.
+ */
+static void TEST_sch_slow_task(void)
+{
+    TEST_sch_slow_runs++;
+    SIM_advance(TEST_SCH_SLOW_CYCLES);
+}
+
+/**
+ * @brief This function is used to let one tick pass then run the released tasks.
+ */
+static driver_status_t TEST_sch_tick(void)
+{
+    SIM_advance(TEST_SCH_TICK_CYCLES);
+
+    /* Serve the tick if the Timebase overflow has been served first */
+    SIM_advance(0U);
+
+    return SCH_dispatch();
+}
+
+/**
+ * @brief It tests the releases of the tasks by their periods and offsets, and their statistics.
+ */
+static void TEST_sch_periods(void)
+{
+    uint8_t fast_id = 0U;
+    uint8_t slow_id = 0U;
+    uint8_t tick = 0U;
+    uint8_t overruns = 0U;
+    uint16_t runs = 0U;
+    sch_task_stats_t stats;
+
+    TEST_sch_fast_runs = 0U;
+    TEST_sch_slow_runs = 0U;
+    TEST_CHECK(SCH_init() == DRIVER_IS_OK);
+    TEST_CHECK(SCH_add_task(TEST_sch_fast_task, 2U, 0U, 0U, &fast_id) == DRIVER_IS_OK);
+    TEST_CHECK(SCH_add_task(TEST_sch_slow_task, 3U, 1U, TEST_SCH_SLOW_BUDGET, &slow_id) == DRIVER_IS_OK);
+    TEST_CHECK(fast_id != slow_id);
+    TEST_CHECK(SCH_start() == DRIVER_IS_OK);
+
+    /* The fast task runs every 2 ticks and the slow task every 3 ticks after 1 tick */
+    for (tick = 0U; tick < TEST_SCH_TICKS; tick++)
+    {
+        overruns += (TEST_sch_tick() == SCH_TASK_OVERRUN) ? 1U : 0U;
+    }
+    TEST_CHECK(TEST_sch_fast_runs == (TEST_SCH_TICKS / 2U));
+    TEST_CHECK(TEST_sch_slow_runs == (TEST_SCH_TICKS / 3U));
+
+    /* Each run of the slow task exceeds its budget */
+    TEST_CHECK(overruns == TEST_sch_slow_runs);
+    TEST_CHECK(SCH_get_task_stats(slow_id, &stats) == DRIVER_IS_OK);
+    TEST_CHECK((stats.runs == TEST_sch_slow_runs) && (stats.overruns == TEST_sch_slow_runs));
+    TEST_CHECK((stats.wcet_ticks >= TEST_SCH_SLOW_CYCLES) && (stats.last_ticks >= TEST_SCH_SLOW_CYCLES));
+    TEST_CHECK(stats.budget_ticks == TEST_SCH_SLOW_BUDGET);
+    TEST_CHECK(SCH_get_task_stats(fast_id, &stats) == DRIVER_IS_OK);
+    TEST_CHECK((stats.runs == TEST_sch_fast_runs) && (stats.overruns == 0U) && (stats.missed_slots == 0U));
+
+    /* The fast task is released twice in 4 ticks without dispatch, it runs once and misses one slot */
+    runs = TEST_sch_fast_runs;
+    for (tick = 0U; tick < 4U; tick++)
+    {
+        SIM_advance(TEST_SCH_TICK_CYCLES);
+        SIM_advance(0U);
+    }
+    (void)SCH_dispatch();
+    TEST_CHECK(TEST_sch_fast_runs == (runs + 1U));
+    TEST_CHECK(SCH_get_task_stats(fast_id, &stats) == DRIVER_IS_OK);
+    TEST_CHECK((stats.runs == TEST_sch_fast_runs) && (stats.missed_slots == 1U));
+}
+
+/**
+ * @brief It tests the full tasks table and the invalid arguments.
+ */
+static void TEST_sch_arguments(void)
+{
+    uint8_t task_id = 0U;
+    uint8_t index = 0U;
+    sch_task_stats_t stats;
+
+    TEST_CHECK(SCH_init() == DRIVER_IS_OK);
+    TEST_CHECK(SCH_get_task_stats(0U, &stats) == VALUE_IS_NOT_EXISTED);
+    for (index = 0U; index < SCH_MAX_TASKS; index++)
+    {
+        TEST_CHECK(SCH_add_task(TEST_sch_fast_task, 1U, 0U, 0U, &task_id) == DRIVER_IS_OK);
+    }
+    TEST_CHECK(SCH_add_task(TEST_sch_fast_task, 1U, 0U, 0U, &task_id) == SCH_TASKS_ARE_FULL);
+
+    TEST_CHECK(SCH_init() == DRIVER_IS_OK);
+    TEST_CHECK(SCH_add_task(NULL_PTR, 1U, 0U, 0U, &task_id) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(SCH_add_task(TEST_sch_fast_task, 1U, 0U, 0U, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+    TEST_CHECK(SCH_add_task(TEST_sch_fast_task, SCH_NO_PERIOD, 0U, 0U, &task_id) == VALUE_IS_NOT_ACCEPTED_FOR_THIS_DRIVER);
+    TEST_CHECK(SCH_get_task_stats(SCH_MAX_TASKS, &stats) == VALUE_IS_NOT_EXISTED);
+    TEST_CHECK(SCH_get_task_stats(0U, NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Scheduler Test Suite
+ */
+void TEST_sch(void)
+{
+    SIM_reset();
+
+    TEST_sch_periods();
+    TEST_sch_arguments();
+
+    /* Stop the tick */
+    (void)SCH_init();
+    ((SREG->bits).I) = GLOBAL_INTERRUPT_DISABLE;
+}
@@ -0,0 +1,158 @@
+/*****************************************************************************
+ * @Author                : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @CreatedDate           : 2026-10-18 04:16:00                              *
+ * @LastEditors           : Islam Tarek<islamtarek0550@gmail.com>            *
+ * @LastEditDate          : 2026-10-18 04:16:00                              *
+ * @FilePath              : TEST_stk.c                                       *
+ ****************************************************************************/
+
+/**
+ * @brief Stack Monitor Tests
+ * @note The stack pointer is set in SPH:SPL and the stack bytes are written in the simulated SRAM by the tests.
+ */
+
+/**
+ * @section Includes
+ */
+
+#include "../Atmega32/atmega32_reg.h"
+#include "../Atmega32/HostSim/SIM_int.h"
+#include "../Atmega32/StackMonitor/STK_int.h"
+#include "../Atmega32/StackMonitor/STK_priv.h"
+#include "../Atmega32/StackMonitor/STK_cfg.h"
+#include "TEST_int.h"
+
+
+/**
+ * @section Definitions
+ */
+
+/**
+ * @brief Stack pointer of the tests, the painted bytes end STK_PAINT_MARGIN bytes below it
+ */
+#define TEST_STK_SP                 0x0400U
+#define TEST_STK_TOP                (TEST_STK_SP - STK_PAINT_MARGIN)
+
+/**
+ * @brief Stack bytes used below the painted top by the tests
+ */
+#define TEST_STK_USED_BYTES         10U
+
+/**
+ * @brief Maximum number of scans of one pass
+ */
+#define TEST_STK_MAX_SCANS          ((SIM_DATA_SPACE_SIZE / STK_SCAN_BUDGET) + 1U)
+
+
+/**
+ * @section Private Functions
+ */
+
+/**
+ * @brief This function is used to set the stack pointer.
+ */
+static void TEST_stk_set_sp(uint16_t stack_pointer)
+{
+    (SPL->reg) = (uint8_t)stack_pointer;
+    (SPH->reg) = (uint8_t)(stack_pointer >> STK_SP_MOST_BYTE);
+}
+
+/**
+ * @brief This function is used to scan until a whole pass is done.
+ */
+static void TEST_stk_scan_pass(void)
+{
+    uint16_t scans = 0U;
+
+    for (scans = 0U; scans < TEST_STK_MAX_SCANS; scans++)
+    {
+        (void)STK_scan();
+    }
+}
+
+/**
+ * @brief It tests the painting, the high-water mark and the bounded scans.
+ */
+static void TEST_stk_watermark(void)
+{
+    stk_stats_t stats;
+    uint16_t address = 0U;
+    uint16_t unpainted = 0U;
+
+    TEST_stk_set_sp(TEST_STK_SP);
+    TEST_CHECK(STK_init() == DRIVER_IS_OK);
+
+    /* The free SRAM is painted up to the margin below the stack pointer */
+    for (address = SIM_DATA_END_ADDRESS; address <= TEST_STK_TOP; address++)
+    {
+        unpainted += (SIM_data_space[address] != STK_CANARY) ? 1U : 0U;
+    }
+    TEST_CHECK(unpainted == 0U);
+    TEST_CHECK(SIM_data_space[TEST_STK_TOP + 1U] != STK_CANARY);
+
+    TEST_stk_scan_pass();
+    TEST_CHECK(STK_get_stats(&stats) == DRIVER_IS_OK);
+    TEST_CHECK(stats.size_bytes == (STK_RAM_END - SIM_DATA_END_ADDRESS + 1U));
+    TEST_CHECK(stats.max_used_bytes == (STK_RAM_END - TEST_STK_TOP));
+    TEST_CHECK(stats.min_free_bytes == (TEST_STK_TOP + 1U - SIM_DATA_END_ADDRESS));
+    TEST_CHECK(stats.is_overflowed == CLEAR_VALUE);
+
+    /* The stack grows, one scan checks STK_SCAN_BUDGET bytes only, so the new mark is found by a later scan */
+    for (address = (TEST_STK_TOP + 1U - TEST_STK_USED_BYTES); address <= TEST_STK_TOP; address++)
+    {
+        SIM_data_space[address] = 0U;
+    }
+    TEST_CHECK(STK_scan() == DRIVER_IS_OK);
+    TEST_CHECK((STK_get_stats(&stats) == DRIVER_IS_OK) && (stats.max_used_bytes == (STK_RAM_END - TEST_STK_TOP)));
+    TEST_stk_scan_pass();
+    TEST_CHECK((STK_get_stats(&stats) == DRIVER_IS_OK) &&
+               (stats.max_used_bytes == (STK_RAM_END - TEST_STK_TOP + TEST_STK_USED_BYTES)));
+    TEST_CHECK(STK_check() == DRIVER_IS_OK);
+}
+
+/**
+ * @brief It tests the overflow detection by the guard bytes and the stack pointer.
+ */
+static void TEST_stk_overflow(void)
+{
+    stk_stats_t stats;
+
+    /* A used guard byte is an overflow, and it is sticky */
+    TEST_stk_set_sp(TEST_STK_SP);
+    TEST_CHECK(STK_init() == DRIVER_IS_OK);
+    SIM_data_space[SIM_DATA_END_ADDRESS + STK_GUARD_SIZE - 1U] = 0U;
+    TEST_CHECK(STK_check() == STK_STACK_OVERFLOW);
+    SIM_data_space[SIM_DATA_END_ADDRESS + STK_GUARD_SIZE - 1U] = STK_CANARY;
+    TEST_CHECK(STK_check() == STK_STACK_OVERFLOW);
+    TEST_CHECK((STK_get_stats(&stats) == DRIVER_IS_OK) && (stats.is_overflowed == SET_VALUE));
+
+    /* The scan finds the used guard byte */
+    TEST_CHECK(STK_init() == DRIVER_IS_OK);
+    SIM_data_space[SIM_DATA_END_ADDRESS] = 0U;
+    TEST_CHECK(STK_scan() == STK_STACK_OVERFLOW);
+
+    /* The stack pointer in the guard bytes */
+    TEST_CHECK(STK_init() == DRIVER_IS_OK);
+    TEST_stk_set_sp(SIM_DATA_END_ADDRESS + STK_GUARD_SIZE - 1U);
+    TEST_CHECK(STK_check() == STK_STACK_OVERFLOW);
+
+    /* No free SRAM to paint */
+    TEST_CHECK(STK_init() == STK_STACK_OVERFLOW);
+    TEST_CHECK(STK_get_stats(NULL_PTR) == PTR_USED_IS_NULL_PTR);
+}
+
+
+/**
+ * @section Implementation
+ */
+
+/**
+ * @brief Stack Monitor Test Suite
+ */
+void TEST_stk(void)
+{
+    SIM_reset();
+
+    TEST_stk_watermark();
+    TEST_stk_overflow();
+}